@@ -38,5 +38,21 @@
 #define ROSETTAFOLD_PATH "/path/to/rosettafold_repo"
 #define CHARMM_exec "/path/to/charmm_executable"
 
+// The number of threads that PANTZ uses for calculations that can be split up,
+// such as the EPPI feature calculations. A value of 0 uses every core that the
+// computer reports. It may also be set when compiling with -DPANTZ_THREADS=N
+#ifndef PANTZ_THREADS
+#define PANTZ_THREADS 0
+#endif
+
+// The structures loaded from PDB and mmCIF files can be kept in binary cache
+// files, which are used instead of the text the next time a file with the same
+// contents is loaded. This is the folder the cache files are kept in. When it
+// is empty, nothing is cached. It may also be set when compiling with
+// -DPANTZ_CACHE_PATH='"/path/to/cache/"'
+#ifndef PANTZ_CACHE_PATH
+#define PANTZ_CACHE_PATH ""
+#endif
+
 // End the header guard from the start of the file
 #endif
@@ -12,6 +12,7 @@
 // Include the Proteins header file, which includes several other header files
 // of interest
 #include "Proteins.h"
+#include <functional>
 
 // Methods are grouped into several categories, based on broad commonalities
 // they have. Each category has a separate namespace
@@ -35,6 +36,10 @@ namespace METHODS {
     void open_file (const string&, ifstream&);
     // list directories
     vector<string> listdir(string);
+    // The number of threads used by parallel calculations
+    size_t thread_count ();
+    // Run a function for every index in a range using several threads
+    void parallel_for (const size_t, const function<void(size_t)>&);
     
     // A function to align the global structure of two proteins
     void global_align (PROT::Protein*, PROT::Protein*, const string&);
@@ -45,6 +50,7 @@ namespace METHODS {
     // method to make a mutation
     PROT::PDB make_mutation(PROT::PDB*, string&, string&);
     vector<PROT::Protein> make_mutation(vector<PROT::Protein>&, string&, string&);
+    vector<PROT::Protein> make_mutation(const PROT::Snapshot&, string&, string&);
 };
 
 // Use a pre-processor directive to make sure that Methods are all included
@@ -58,6 +64,7 @@ namespace METHODS {
 #include "Methods/make_folder.h"
 #include "Methods/open_file.h"
 #include "Methods/listdir.h"
+#include "Methods/parallel_for.h"
 #include "Methods/align.h"
 #include "Methods/CHARMM.h"
 #include "Methods/Rosetta.h"
@@ -67,11 +67,17 @@ namespace EPPI {
     // Split them into a vector
     const vector<string> PrimaryFeaturesList = Text::split(PrimaryFeatureNames);
 
+    // The residue neighbor lists of a structure, which can be kept and used
+    // again for similar structures, such as the members of an ensemble
+    class NeighborLists;
+
     // A function to scan the interface of a binding complex of proteins and get
     // the expected persistent pairwise interaction features. It writes them to
     // a file, features.txt, in the output directory and also runs the Rosetta
-    // interface analyzer and per residue analysis
-    void calculate_eppi_features (vector<PROT::Protein *>&, string&, string&, bool);
+    // interface analyzer and per residue analysis. If neighbor lists are
+    // provided, they are updated for the proteins and used
+    void calculate_eppi_features (vector<PROT::Protein *>&, string&, string&, bool,
+                                  NeighborLists * = 0);
 
     // Gather the EPPI features from directories containing the required files
     void gather_eppi_features (string, vector<string>, string, string, bool);
@@ -106,6 +112,7 @@ namespace EPPI {
 
 // Include the header files
 #include "EPPI/Feature.h"
+#include "EPPI/NeighborLists.h"
 #include "EPPI/calculate_eppi_features.h"
 #include "EPPI/Residue.h"
 #include "EPPI/Interaction.h"
@@ -56,7 +56,8 @@ class EPPI::BCProps {
         map<string, double> parse_per_res_file(string per_res_rosetta_file);
         vector<double> parse_ria_file(string ria_file);
         void parse_eppi_file(string eppi_file, vector<HydrogenBond*> &hydrogen_bonds, 
-            vector<SaltBridge*> &salt_bridges, vector<Hydrophobic*> &hydrophobic_interactions);
+            vector<SaltBridge*> &salt_bridges, vector<Hydrophobic*> &hydrophobic_interactions,
+            PROT::Arena& arena);
         // Construct a class instance from "good string" and "row string"
         // outputs
         void good_str_constructor (const vector<string>&);
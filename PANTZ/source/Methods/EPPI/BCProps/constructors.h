@@ -114,9 +114,14 @@ void EPPI::BCProps::directory_constructor (const string& name, const string& dir
     vector<EPPI::HydrogenBond*> hydrogen_bonds;
     vector<EPPI::SaltBridge*> salt_bridges;
     vector<EPPI::Hydrophobic*> hydrophobic_interactions;
+    // the interactions are made in an arena that each thread keeps, so the
+    // memory of one binding complex is used again for the next one. Reset it
+    // first in case an earlier complex stopped with an error
+    static thread_local PROT::Arena arena;
+    arena.reset();
 
     // parse the EPPI file
-    parse_eppi_file(dir+"/features.txt", hydrogen_bonds, salt_bridges, hydrophobic_interactions);
+    parse_eppi_file(dir+"/features.txt", hydrogen_bonds, salt_bridges, hydrophobic_interactions, arena);
 
     // set the energy of the interactions
     for (int i = 0; i < hydrogen_bonds.size(); i++) {
@@ -130,6 +135,8 @@ void EPPI::BCProps::directory_constructor (const string& name, const string& dir
     }
     // create the base features using the interaction constructor
     interaction_constructor(name, hydrogen_bonds, salt_bridges, hydrophobic_interactions, ria_values);
+    // the interactions are not needed any more
+    arena.reset();
     // If verbose, remove the 3 files
     if (!verbose) {
         string cmd = "rm " + dir + "/features.txt " + dir + "/rosetta_residue_scores.sc " +
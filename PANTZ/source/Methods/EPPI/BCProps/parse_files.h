@@ -55,18 +55,20 @@ vector<double> EPPI::BCProps::parse_ria_file(string ria_file) {
 }
 
 // this is the function to parse the features.txt file and get the 
-// hydrogen bonds, salt bridges, and hydrophobic interactions
+// hydrogen bonds, salt bridges, and hydrophobic interactions. They are made in
+// the arena, which owns them
 void EPPI::BCProps::parse_eppi_file(string eppi_file, vector<EPPI::HydrogenBond*> &hydrogen_bonds, 
-    vector<EPPI::SaltBridge*> &salt_bridges, vector<EPPI::Hydrophobic*> &hydrophobic_interactions) {
+    vector<EPPI::SaltBridge*> &salt_bridges, vector<EPPI::Hydrophobic*> &hydrophobic_interactions,
+    PROT::Arena& arena) {
     ifstream f(eppi_file);
     string line;
     while (getline(f, line)) {
         if (line.find("Hydrogen Bond") != string::npos) {
-            hydrogen_bonds.push_back(new EPPI::HydrogenBond(line));
+            hydrogen_bonds.push_back(arena.make<EPPI::HydrogenBond>(line, arena));
         } else if (line.find("Salt Bridge") != string::npos) {
-            salt_bridges.push_back(new EPPI::SaltBridge(line));
+            salt_bridges.push_back(arena.make<EPPI::SaltBridge>(line, arena));
         } else if (line.find("Hydrophobic Interaction") != string::npos) {
-            hydrophobic_interactions.push_back(new EPPI::Hydrophobic(line));
+            hydrophobic_interactions.push_back(arena.make<EPPI::Hydrophobic>(line, arena));
         } else {
             cout<<"Error: unknown interaction type"<<endl;
             // exit the program
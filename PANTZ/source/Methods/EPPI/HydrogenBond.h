@@ -11,7 +11,7 @@
 // this is the hydrogen bond class that inherits from the EPPIInteraction class
 class EPPI::HydrogenBond : public EPPI::Interaction {
     public:
-        HydrogenBond(string line);
+        HydrogenBond(string line, PROT::Arena& arena);
         double distance;
         double dha_angle;
         double daa_angle;
@@ -27,7 +27,7 @@ class EPPI::HydrogenBond : public EPPI::Interaction {
 };
 
 // this is the constructor for the EPPIHydrogenBond class
-EPPI::HydrogenBond::HydrogenBond(string line) : EPPI::Interaction(line) {
+EPPI::HydrogenBond::HydrogenBond(string line, PROT::Arena& arena) : EPPI::Interaction(line, arena) {
     vector<string> words;
     Text::split(words, line);
     this->distance = stof(words[16]);
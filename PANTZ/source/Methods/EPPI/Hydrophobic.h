@@ -12,7 +12,7 @@
 // this is the class for a hydrophobic interaction that inherits from the EPPIInteraction class
 class EPPI::Hydrophobic : public Interaction {
     public:
-        Hydrophobic(string line);
+        Hydrophobic(string line, PROT::Arena& arena);
         double bsasa;
         bool is_real() {return true;};
         string str() {
@@ -25,7 +25,7 @@ class EPPI::Hydrophobic : public Interaction {
 };
 
 // this is the constructor for the EPPIHydrophobic class
-EPPI::Hydrophobic::Hydrophobic(string line) : EPPI::Interaction(line) {
+EPPI::Hydrophobic::Hydrophobic(string line, PROT::Arena& arena) : EPPI::Interaction(line, arena) {
     vector<string> words;
     Text::split(words, line);
     this->bsasa = stof(words[16]);
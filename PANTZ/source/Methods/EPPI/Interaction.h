@@ -12,7 +12,8 @@
 // this is the class for an EPPI interaction
 class EPPI::Interaction {
     public:
-        Interaction(string line);
+        // the residues are made in the arena, which owns them
+        Interaction(string line, PROT::Arena& arena);
         double energy = 0.0;
         EPPI::Residue* residue1;
         EPPI::Residue* residue2;
@@ -27,13 +28,13 @@ class EPPI::Interaction {
 };
 
 // this is the constructor for the EPPIInteraction class
-EPPI::Interaction::Interaction(string line) {
+EPPI::Interaction::Interaction(string line, PROT::Arena& arena) {
     vector<string> words;
     Text::split(words, line);
-    this->residue1 = new EPPI::Residue(words[2].substr(0, 3), stoi(words[2].substr(4, words[2].size() - 6)), 
+    this->residue1 = arena.make<EPPI::Residue>(words[2].substr(0, 3), stoi(words[2].substr(4, words[2].size() - 6)), 
         words[2][words[2].size() - 1], stoi(words[6]), 
         stoi(words[7]), words[3], words[4]);
-    this->residue2 = new EPPI::Residue(words[9].substr(0, 3), stoi(words[9].substr(4, words[9].size() - 6)), 
+    this->residue2 = arena.make<EPPI::Residue>(words[9].substr(0, 3), stoi(words[9].substr(4, words[9].size() - 6)), 
         words[9][words[9].size() - 1], stoi(words[13]), 
         stoi(words[14]), words[10], words[11]);
 }
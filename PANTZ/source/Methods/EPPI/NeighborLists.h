@@ -0,0 +1,99 @@
+/* Created by the PROTEIN PANT(z) Lab at Auburn University.
+ *
+ * This file contains the definition of the EPPI::NeighborLists class. It keeps
+ * the residue neighbor lists used to determine the stability of residues in
+ * calculate_eppi_features, so that they can be used again for the next
+ * structure of an ensemble. The lists are only built again when a structure
+ * has different residues or when too many of its residues have moved by more
+ * than half of the skin distance. */
+
+// Make sure the file is only included in a compiled program one time
+#ifndef EPPI_NeighborLists_Guard
+#define EPPI_NeighborLists_Guard 1
+
+// Make sure the file is being included as expected
+#ifndef EPPI_Loading_Status
+#error NeighborLists.h has to be included by EPPI.h
+#endif
+
+// Define the class
+class EPPI::NeighborLists {
+
+    // The information stored in the class is private
+    private:
+        // The proteins and residues the lists were last used for, to tell
+        // whether a structure has the same residues. Only the residues matter,
+        // so members of an ensemble whose hydrogens are named differently
+        // (such as histidines with different protonation states) can share them
+        string m_topology;
+        // Every residue that has a CA atom, and the place of each of them
+        vector<PROT::Residue *> m_residues;
+        map<PROT::Residue *, size_t> m_residue_index;
+        // The neighbor list of the residues' CA atoms
+        PROT::NeighborList<PROT::Residue> m_residue_list;
+
+    // The public interface of the class
+    public:
+        // Construct the lists from the largest distance that will be searched
+        // between residues (CA atoms) and the skin
+        NeighborLists (const float residue_cutoff = 14.0, const float skin = 2.0) :
+            m_residue_list (residue_cutoff, skin) {}
+        // Use the lists for a set of proteins
+        void update (vector<PROT::Protein *>&);
+        // The number of times the lists have been built
+        size_t builds () const {return m_residue_list.builds();}
+        // The residues whose CA atoms are within a radius of a residue's CA
+        // atom, not including the residue itself. The neighbors are not sorted
+        vector<PROT::Residue *> residue_neighbors (PROT::Residue *, const float) const;
+};
+
+// Use the lists for a set of proteins
+void EPPI::NeighborLists::update (vector<PROT::Protein *>& proteins) {
+    string topology;
+    m_residues.clear();
+    m_residue_index.clear();
+    for (size_t i = 0; i < proteins.size(); i++) {
+        topology += proteins[i]->name();
+        topology += ":";
+        for (size_t j = 0; j < proteins[i]->size(); j++) {
+            PROT::Residue * res = proteins[i]->operator()(j, ' ', true);
+            bool CA = false;
+            for (size_t k = 0; k < res->size(); k++) {
+                if (res->get_atom(k)->name() == "CA") {CA = true;}
+            }
+            topology += res->name() + to_string(res->number()) + res->insertion_code();
+            topology += (CA ? ":" : "-");
+            if (CA) {
+                m_residue_index[res] = m_residues.size();
+                m_residues.push_back(res);
+            }
+        }
+    }
+    // Lists built for other residues can not be used
+    if (topology != m_topology) {
+        m_residue_list.clear();
+        m_topology = topology;
+    }
+    m_residue_list.update(m_residues);
+}
+
+// The neighbors of a residue
+vector<PROT::Residue *> EPPI::NeighborLists::residue_neighbors (PROT::Residue * res, const float radius) const {
+    map<PROT::Residue *, size_t>::const_iterator it = m_residue_index.find(res);
+    if (it == m_residue_index.end()) {
+        // a residue without a CA atom has no position. This raises the error
+        res->CA();
+        string error = "The residue is not part of the proteins of the neighbor lists\n";
+        throw PANTZ_error (error);
+    }
+    vector<size_t> places = m_residue_list.neighbors(it->second, radius);
+    vector<PROT::Residue *> neighbors;
+    neighbors.reserve(places.size());
+    for (size_t i = 0; i < places.size(); i++) {
+        neighbors.push_back(m_residues[places[i]]);
+    }
+    return neighbors;
+}
+
+// End the header guard from the start of the file
+#endif
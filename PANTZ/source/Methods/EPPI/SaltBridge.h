@@ -13,7 +13,7 @@
 // this is the class for a salt bridge that inherits from the EPPIInteraction class
 class EPPI::SaltBridge : public EPPI::Interaction {
     public:
-        SaltBridge(string line);
+        SaltBridge(string line, PROT::Arena& arena);
         double distance;
         bool is_real() {return true;};
         string str() {
@@ -26,7 +26,7 @@ class EPPI::SaltBridge : public EPPI::Interaction {
 };
 
 // this is the constructor for the EPPISaltBridge class
-EPPI::SaltBridge::SaltBridge(string line) : EPPI::Interaction(line) {
+EPPI::SaltBridge::SaltBridge(string line, PROT::Arena& arena) : EPPI::Interaction(line, arena) {
     vector<string> words;
     Text::split(words, line);
     this->distance = stof(words[16]);
@@ -12,11 +12,17 @@
 #endif
 
 // a function to scan the interface and get the expected persistent pairwise interaction features
-void EPPI::calculate_eppi_features(vector<PROT::Protein*>& proteins, string& interface, string& output_path, bool verbose){
+void EPPI::calculate_eppi_features(vector<PROT::Protein*>& proteins, string& interface, string& output_path, bool verbose,
+                                   EPPI::NeighborLists * neighbor_lists){
     // update atoms after rosetta
     for (size_t i = 0; i < proteins.size(); i++){
         proteins[i]->update_atoms_after_Rosetta();
     }
+    // the residue neighbor lists. When lists are provided, they are kept and
+    // used again for the next structure
+    EPPI::NeighborLists local_lists;
+    EPPI::NeighborLists& lists = (neighbor_lists != 0) ? *neighbor_lists : local_lists;
+    lists.update(proteins);
     // get the characters before the _ in the interface string
     string interface_side1 = interface.substr(0, interface.find("_"));
     string interface_side2 = interface.substr(interface.find("_")+1, interface.size());
@@ -25,58 +31,59 @@ void EPPI::calculate_eppi_features(vector<PROT::Protein*>& proteins, string& int
     vector<PROT::Residue*> protein1_residues;
     vector<PROT::Residue*> protein2_residues;
     float cutoff = 6.0; // cutoff for interface residues
-    // get the residues in interface side 1 that are within cutoff of a residue in interface side 2
+    // put the atoms of each side of the interface into a grid, so that each
+    // atom only needs to be compared with the atoms of the other side that are
+    // near it
+    vector<PROT::Atom*> side1_atoms;
+    vector<PROT::Atom*> side2_atoms;
     for (size_t i = 0; i < proteins.size(); i++){
-        // go through residues in the protein
+        bool on_side1 = (interface_side1.find(proteins[i]->name()) != string::npos);
+        bool on_side2 = (interface_side2.find(proteins[i]->name()) != string::npos);
         for (size_t j = 0; j < proteins[i]->size(); j++){
             PROT::Residue * res = proteins[i]->operator()(j, ' ', true);
-            // ensure they are on side 1
-            if (interface_side1.find(res->protein()) != string::npos){
-                // go through residues in the protein again
-                for (size_t k = 0; k < proteins.size(); k++){
-                    // ensure this protein is on side 2
-                    if (interface_side2.find(proteins[k]->name()) != string::npos){
-                        // go through the residues in the protein
-                        for (size_t l = 0; l < proteins[k]->size(); l++){
-                            PROT::Residue * res2 = proteins[k]->operator()(l, ' ', true);
-                            if (res->min_distance(*res2) < cutoff){
-                                protein1_residues.push_back(proteins[i]->operator()(j, ' ', true));
-                                for (size_t m = 0; m < res->size(); m++){
-                                    interface_atoms_ptrs.push_back(res->get_atom(m));
-                                }
-                                break;
-                            }
-                        }
-                    }
-                }
+            for (size_t m = 0; m < res->size(); m++){
+                if (on_side1){side1_atoms.push_back(res->get_atom(m));}
+                if (on_side2){side2_atoms.push_back(res->get_atom(m));}
             }
         }
     }
-
-    // get the residues in interface side 2 that are within cutoff of a residue in interface side 1
+    PROT::Grid<PROT::Atom> side1_grid(side1_atoms, cutoff);
+    PROT::Grid<PROT::Atom> side2_grid(side2_atoms, cutoff);
+    // a residue is in the interface if any of its atoms is within the cutoff of
+    // an atom on the other side. The grid does not compare an atom with
+    // itself, so a residue of a protein listed on both sides is always in the
+    // interface (its minimum distance to itself is 0)
+    auto in_interface = [&](PROT::Residue * res, const string& other_side, const PROT::Grid<PROT::Atom>& grid){
+        if ((res->size() > 0) && (other_side.find(res->protein()) != string::npos)){
+            return true;
+        }
+        for (size_t m = 0; m < res->size(); m++){
+            if (grid.any_within(res->get_atom(m), cutoff)){
+                return true;
+            }
+        }
+        return false;
+    };
+    // get the residues in interface side 1 that are within cutoff of a residue in interface side 2
+    // and the residues in interface side 2 that are within cutoff of a residue in interface side 1
     for (size_t i = 0; i < proteins.size(); i++){
         // go through residues in the protein
         for (size_t j = 0; j < proteins[i]->size(); j++){
             PROT::Residue * res = proteins[i]->operator()(j, ' ', true);
+            // ensure they are on side 1
+            if ((interface_side1.find(res->protein()) != string::npos) &&
+                (in_interface(res, interface_side2, side2_grid))){
+                protein1_residues.push_back(res);
+                for (size_t m = 0; m < res->size(); m++){
+                    interface_atoms_ptrs.push_back(res->get_atom(m));
+                }
+            }
             // ensure they are on side 2
-            if (interface_side2.find(res->protein()) != string::npos){
-                // go through residues in the protein again
-                for (size_t k = 0; k < proteins.size(); k++){
-                    // ensure this protein is on side 1
-                    if (interface_side1.find(proteins[k]->name()) != string::npos){
-                        // go through the residues in the protein
-                        for (size_t l = 0; l < proteins[k]->size(); l++){
-                            PROT::Residue * res2 = proteins[k]->operator()(l, ' ', true);
-                            if (res->min_distance(*res2) < cutoff){
-                                protein2_residues.push_back(res);
-                                for (size_t m = 0; m < res->size(); m++){
-                                    PROT::Atom * atom = res->get_atom(m);
-                                    interface_atoms_ptrs.push_back(atom);
-                                }
-                                break;
-                            }
-                        }
-                    }
+            if ((interface_side2.find(res->protein()) != string::npos) &&
+                (in_interface(res, interface_side1, side1_grid))){
+                protein2_residues.push_back(res);
+                for (size_t m = 0; m < res->size(); m++){
+                    interface_atoms_ptrs.push_back(res->get_atom(m));
                 }
             }
         }
@@ -105,17 +112,45 @@ void EPPI::calculate_eppi_features(vector<PROT::Protein*>& proteins, string& int
     float dha_angle = 120; // angle threshold for hydrogen bond in degrees
     float daa_angle = 90; // angle threshold for hydrogen bond in degrees
     float sasa_cutoff = 24.438; // cutoff for hydrophobic interactions
-    for (auto res1 : protein1_residues){
+    // the farthest apart two atoms can be and still interact. A solvent
+    // accessible point of one atom can only be buried by another atom if the
+    // atoms are closer than the sum of their radii and two probe radii
+    float probe = 1.4;
+    float reach = max(max(hb_distance, sb_distance), 2 * (PROT::Atom::max_lj_sigma() + probe));
+    // the residues of side 1 are divided between threads. Each thread keeps the
+    // interactions (and verbose output) of its residues separate so that they
+    // can be merged in the same order as scanning the residues one at a time
+    vector<vector<PROT::HydrogenBond>> residue_hbonds (protein1_residues.size());
+    vector<vector<PROT::SaltBridge>> residue_salt_bridges (protein1_residues.size());
+    vector<vector<PROT::Hydrophobic>> residue_hydrophobics (protein1_residues.size());
+    vector<string> residue_output (protein1_residues.size());
+    METHODS::parallel_for(protein1_residues.size(), [&] (size_t i) {
+        PROT::Residue * res1 = protein1_residues[i];
+        stringstream output;
         for (auto res2 : protein2_residues){
+            // residues whose atoms are all too far apart cannot interact
+            if (!res1->near(*res2, reach)){
+                continue;
+            }
             // get the number of hydrogen bonds between the residues
-            vector<PROT::HydrogenBond> hbond = res1->hbond(res2, hb_distance, dha_angle, daa_angle, verbose);
-            vector<PROT::SaltBridge> salt_bridge = res1->salt_bridge(res2, sb_distance, verbose);
-            vector<PROT::Hydrophobic> hydrophobic_interaction = res1->hydrophobic(res2, sasa_cutoff, verbose);  
+            vector<PROT::HydrogenBond> hbond = res1->hbond(res2, hb_distance, dha_angle, daa_angle, verbose, output);
+            vector<PROT::SaltBridge> salt_bridge = res1->salt_bridge(res2, sb_distance, verbose, output);
+            vector<PROT::Hydrophobic> hydrophobic_interaction = res1->hydrophobic(res2, sasa_cutoff, verbose, output);
             // add the hydrogen bonds to the list
-            hbonds.insert(hbonds.end(), hbond.begin(), hbond.end());
-            salt_bridges.insert(salt_bridges.end(), salt_bridge.begin(), salt_bridge.end());
-            hydrophobic_interactions.insert(hydrophobic_interactions.end(), hydrophobic_interaction.begin(), hydrophobic_interaction.end());
+            residue_hbonds[i].insert(residue_hbonds[i].end(), hbond.begin(), hbond.end());
+            residue_salt_bridges[i].insert(residue_salt_bridges[i].end(), salt_bridge.begin(), salt_bridge.end());
+            residue_hydrophobics[i].insert(residue_hydrophobics[i].end(), hydrophobic_interaction.begin(), hydrophobic_interaction.end());
         }
+        residue_output[i] = output.str();
+    });
+    // merge the interactions of each residue in order
+    for (size_t i = 0; i < protein1_residues.size(); i++){
+        if (verbose){
+            cout<<residue_output[i];
+        }
+        hbonds.insert(hbonds.end(), residue_hbonds[i].begin(), residue_hbonds[i].end());
+        salt_bridges.insert(salt_bridges.end(), residue_salt_bridges[i].begin(), residue_salt_bridges[i].end());
+        hydrophobic_interactions.insert(hydrophobic_interactions.end(), residue_hydrophobics[i].begin(), residue_hydrophobics[i].end());
     }
 
     if (verbose){
@@ -124,114 +159,132 @@ void EPPI::calculate_eppi_features(vector<PROT::Protein*>& proteins, string& int
         cout<<"Number of hydrophobic interactions: "<<hydrophobic_interactions.size()<<endl;
         cout<<"\nSetting the stability of the residues"<<endl;
     }
-    string how;
-    bool backbone = false;
     vector<PROT::Residue*> all_residues;
     all_residues.insert(all_residues.end(), protein1_residues.begin(), protein1_residues.end());
     all_residues.insert(all_residues.end(), protein2_residues.begin(), protein2_residues.end());
-    // go through the hydrogen bond, salt bridge, and hydrophobic interaction lists and set the stability of the residues
-    for (size_t i = 0; i < hbonds.size(); i++){
-        // get the neighbors of the donor and acceptor, inter and intra
-        // if the donor name is the same as prot1 pass prot1 as the protein, else pass prot2
-        vector<PROT::Residue*> donor_intra_neighbors;
-        vector<PROT::Residue*> acceptor_intra_neighbors;
-        vector<PROT::Residue*> donor_inter_neighbors;
-        vector<PROT::Residue*> acceptor_inter_neighbors;
-        // if (hbonds[i].donor_residue->protein() == prot1->name()){
-        // if tthe donor name char is found in the first chain interface side
-        if (interface_side1.find(hbonds[i].donor_residue->protein()) != string::npos){
-            donor_intra_neighbors = hbonds[i].donor_residue->get_intra_neighbors(protein1_residues, 14);
-            acceptor_intra_neighbors = hbonds[i].acceptor_residue->get_intra_neighbors(protein2_residues, 14);
-            donor_inter_neighbors = hbonds[i].donor_residue->get_inter_neighbors_res(all_residues, 14);
-            acceptor_inter_neighbors = hbonds[i].acceptor_residue->get_inter_neighbors_res(all_residues, 14);
-        } else {
-            donor_intra_neighbors = hbonds[i].donor_residue->get_intra_neighbors(protein2_residues, 14);
-            acceptor_intra_neighbors = hbonds[i].acceptor_residue->get_intra_neighbors(protein1_residues, 14);
-            donor_inter_neighbors = hbonds[i].donor_residue->get_inter_neighbors_res(all_residues, 14);
-            acceptor_inter_neighbors = hbonds[i].acceptor_residue->get_inter_neighbors_res(all_residues, 14);
+
+    // the stability and free rotamers of a residue only depend on the residue
+    // and on which side of the interface its intra neighbors come from. They
+    // are determined once for each of those contexts and shared by every
+    // interaction the residue takes part in
+    struct StabilityContext {
+        PROT::Residue * residue;
+        // whether the intra neighbors come from side 1 or side 2
+        bool side1;
+        // the side chain stabilities (backbone interactions are always stable)
+        bool prestable;
+        bool bound_stable;
+        size_t free_rot_pre;
+        size_t free_rot_bound;
+    };
+    vector<StabilityContext> contexts;
+    map<pair<PROT::Residue*, bool>, size_t> context_index;
+    // the context of each residue in each interaction, in the order of the
+    // interactions: hydrogen bonds, salt bridges and then hydrophobic
+    // interactions, with the donor (res1) before the acceptor (res2)
+    vector<size_t> interaction_contexts;
+    auto add_context = [&] (PROT::Residue * residue, bool side1){
+        pair<PROT::Residue*, bool> key (residue, side1);
+        if (context_index.count(key) == 0){
+            context_index[key] = contexts.size();
+            contexts.push_back({residue, side1, false, false, 0, 0});
         }
-        // get the acceptor rotamers
-        vector<PROT::Residue> acceptor_rotamers = hbonds[i].acceptor_residue->get_rotamers();
-        vector<PROT::Residue> donor_rotamers = hbonds[i].donor_residue->get_rotamers();
-        // set the stability of the residues
-        hbonds[i].donor_residue->set_stability(donor_rotamers, donor_intra_neighbors, backbone=hbonds[i].donor_backbone, how="pre");
-        hbonds[i].donor_residue->set_stability(donor_rotamers, donor_inter_neighbors, backbone=hbonds[i].donor_backbone, how="bound");
-        hbonds[i].acceptor_residue->set_stability(acceptor_rotamers, acceptor_intra_neighbors, backbone=hbonds[i].acceptor_backbone, how="pre");
-        hbonds[i].acceptor_residue->set_stability(acceptor_rotamers, acceptor_inter_neighbors, backbone=hbonds[i].acceptor_backbone, how="bound");
-        // set the free rotamers
-        hbonds[i].donor_free_rot_pre = hbonds[i].donor_residue->free_rotamers(donor_rotamers, donor_intra_neighbors);
-        hbonds[i].donor_free_rot_bound = hbonds[i].donor_residue->free_rotamers(donor_rotamers, donor_inter_neighbors);
-        hbonds[i].acceptor_free_rot_pre = hbonds[i].acceptor_residue->free_rotamers(acceptor_rotamers, acceptor_intra_neighbors);
-        hbonds[i].acceptor_free_rot_bound = hbonds[i].acceptor_residue->free_rotamers(acceptor_rotamers, acceptor_inter_neighbors);
+        interaction_contexts.push_back(context_index[key]);
+    };
+    auto add_interaction = [&] (PROT::Residue * donor, PROT::Residue * acceptor){
+        // if the donor name char is found in the first chain interface side
+        bool side1 = (interface_side1.find(donor->protein()) != string::npos);
+        add_context(donor, side1);
+        add_context(acceptor, !side1);
+    };
+    for (size_t i = 0; i < hbonds.size(); i++){
+        add_interaction(hbonds[i].donor_residue, hbonds[i].acceptor_residue);
     }
-    // set the stability of the salt bridges
     for (size_t i = 0; i < salt_bridges.size(); i++){
-        // get the neighbors of the donor and acceptor, inter and intra
-        // if the donor name is the same as prot1 pass prot1 as the protein, else pass prot2
-        vector<PROT::Residue*> donor_intra_neighbors;
-        vector<PROT::Residue*> acceptor_intra_neighbors;
-        vector<PROT::Residue*> donor_inter_neighbors;
-        vector<PROT::Residue*> acceptor_inter_neighbors;
-        // if the donor name char is found in the first chain interface side
-        if (interface_side1.find(salt_bridges[i].donor_residue->protein()) != string::npos){
-            donor_intra_neighbors = salt_bridges[i].donor_residue->get_intra_neighbors(protein1_residues, 14);
-            acceptor_intra_neighbors = salt_bridges[i].acceptor_residue->get_intra_neighbors(protein2_residues, 14);
-            donor_inter_neighbors = salt_bridges[i].donor_residue->get_inter_neighbors_res(all_residues, 14);
-            acceptor_inter_neighbors = salt_bridges[i].acceptor_residue->get_inter_neighbors_res(all_residues, 14);
-        } else {
-            donor_intra_neighbors = salt_bridges[i].donor_residue->get_intra_neighbors(protein2_residues, 14);
-            acceptor_intra_neighbors = salt_bridges[i].acceptor_residue->get_intra_neighbors(protein1_residues, 14);
-            donor_inter_neighbors = salt_bridges[i].donor_residue->get_inter_neighbors_res(all_residues, 14);
-            acceptor_inter_neighbors = salt_bridges[i].acceptor_residue->get_inter_neighbors_res(all_residues, 14);
-        }
-        // get the acceptor rotamers
-        vector<PROT::Residue> acceptor_rotamers = salt_bridges[i].acceptor_residue->get_rotamers();
-        vector<PROT::Residue> donor_rotamers = salt_bridges[i].donor_residue->get_rotamers();
-        // set the stability of the residues
-        salt_bridges[i].donor_residue->set_stability(donor_rotamers, donor_intra_neighbors, backbone=salt_bridges[i].donor_backbone, how="pre");
-        salt_bridges[i].donor_residue->set_stability(donor_rotamers, donor_inter_neighbors, backbone=salt_bridges[i].donor_backbone, how="bound");
-        salt_bridges[i].acceptor_residue->set_stability(acceptor_rotamers, acceptor_intra_neighbors, backbone=salt_bridges[i].acceptor_backbone, how="pre");
-        salt_bridges[i].acceptor_residue->set_stability(acceptor_rotamers, acceptor_inter_neighbors, backbone=salt_bridges[i].acceptor_backbone, how="bound");
-        // set the free rotamers
-        salt_bridges[i].donor_free_rot_pre = salt_bridges[i].donor_residue->free_rotamers(donor_rotamers, donor_intra_neighbors);
-        salt_bridges[i].donor_free_rot_bound = salt_bridges[i].donor_residue->free_rotamers(donor_rotamers, donor_inter_neighbors);
-        salt_bridges[i].acceptor_free_rot_pre = salt_bridges[i].acceptor_residue->free_rotamers(acceptor_rotamers, acceptor_intra_neighbors);
-        salt_bridges[i].acceptor_free_rot_bound = salt_bridges[i].acceptor_residue->free_rotamers(acceptor_rotamers, acceptor_inter_neighbors);
+        add_interaction(salt_bridges[i].donor_residue, salt_bridges[i].acceptor_residue);
     }
-    // set the stability of the hydrophobic interactions
     for (size_t i = 0; i < hydrophobic_interactions.size(); i++){
-        // get the neighbors of the donor and acceptor, inter and intra
-        // if the donor name is the same as prot1 pass prot1 as the protein, else pass prot2
-        vector<PROT::Residue*> donor_intra_neighbors;
-        vector<PROT::Residue*> acceptor_intra_neighbors;
-        vector<PROT::Residue*> donor_inter_neighbors;
-        vector<PROT::Residue*> acceptor_inter_neighbors;
-        // if (hbonds[i].donor_residue->protein() == prot1->name()){
-        // if tthe donor name char is found in the first chain interface side
-        if (interface_side1.find(hydrophobic_interactions[i].res1->protein()) != string::npos){
-            donor_intra_neighbors = hydrophobic_interactions[i].res1->get_intra_neighbors(protein1_residues, 14);
-            acceptor_intra_neighbors = hydrophobic_interactions[i].res2->get_intra_neighbors(protein2_residues, 14);
-            donor_inter_neighbors = hydrophobic_interactions[i].res1->get_inter_neighbors_res(all_residues, 14);
-            acceptor_inter_neighbors = hydrophobic_interactions[i].res2->get_inter_neighbors_res(all_residues, 14);
-        } else {
-            donor_intra_neighbors = hydrophobic_interactions[i].res1->get_intra_neighbors(protein2_residues, 14);
-            acceptor_intra_neighbors = hydrophobic_interactions[i].res2->get_intra_neighbors(protein1_residues, 14);
-            donor_inter_neighbors = hydrophobic_interactions[i].res1->get_inter_neighbors_res(all_residues, 14);
-            acceptor_inter_neighbors = hydrophobic_interactions[i].res2->get_inter_neighbors_res(all_residues, 14);
+        add_interaction(hydrophobic_interactions[i].res1, hydrophobic_interactions[i].res2);
+    }
+
+    // the rotamers are generated once for each residue, before any thread reads them
+    vector<PROT::Residue*> rotamer_residues;
+    for (size_t i = 0; i < contexts.size(); i++){
+        rotamer_residues.push_back(contexts[i].residue);
+    }
+    sort(rotamer_residues.begin(), rotamer_residues.end());
+    rotamer_residues.erase(unique(rotamer_residues.begin(), rotamer_residues.end()), rotamer_residues.end());
+    METHODS::parallel_for(rotamer_residues.size(), [&] (size_t i) {
+        if (rotamer_residues[i]->rotamers().size() == 0){
+            rotamer_residues[i]->set_rotamers();
         }
-        // get the acceptor rotamers
-        vector<PROT::Residue> acceptor_rotamers = hydrophobic_interactions[i].res2->get_rotamers();
-        vector<PROT::Residue> donor_rotamers = hydrophobic_interactions[i].res1->get_rotamers();
-        // set the stability of the residues
-        hydrophobic_interactions[i].res1->set_stability(donor_rotamers, donor_intra_neighbors, backbone=hydrophobic_interactions[i].res1_backbone, how="pre");
-        hydrophobic_interactions[i].res1->set_stability(donor_rotamers, donor_inter_neighbors, backbone=hydrophobic_interactions[i].res1_backbone, how="bound");
-        hydrophobic_interactions[i].res2->set_stability(acceptor_rotamers, acceptor_intra_neighbors, backbone=hydrophobic_interactions[i].res2_backbone, how="pre");
-        hydrophobic_interactions[i].res2->set_stability(acceptor_rotamers, acceptor_inter_neighbors, backbone=hydrophobic_interactions[i].res2_backbone, how="bound");
-        // set the free rotamers
-        hydrophobic_interactions[i].res1_free_rot_pre = hydrophobic_interactions[i].res1->free_rotamers(donor_rotamers, donor_intra_neighbors);
-        hydrophobic_interactions[i].res1_free_rot_bound = hydrophobic_interactions[i].res1->free_rotamers(donor_rotamers, donor_inter_neighbors);
-        hydrophobic_interactions[i].res2_free_rot_pre = hydrophobic_interactions[i].res2->free_rotamers(acceptor_rotamers, acceptor_intra_neighbors);
-        hydrophobic_interactions[i].res2_free_rot_bound = hydrophobic_interactions[i].res2->free_rotamers(acceptor_rotamers, acceptor_inter_neighbors);
+    });
+
+    // the neighbors of a residue are the residues on one side of the interface
+    // (or on both) whose CA atoms are within 14 angstroms of its CA atom, not
+    // including the residue itself. A residue that is listed on both sides is
+    // counted twice among the residues on both sides
+    map<PROT::Residue*, size_t> side1_members, side2_members, all_members;
+    for (size_t i = 0; i < protein1_residues.size(); i++){
+        side1_members[protein1_residues[i]]++;
+    }
+    for (size_t i = 0; i < protein2_residues.size(); i++){
+        side2_members[protein2_residues[i]]++;
+    }
+    for (size_t i = 0; i < all_residues.size(); i++){
+        // the positions of the residues are their CA atoms, so every residue
+        // needs one
+        all_residues[i]->CA();
+        all_members[all_residues[i]]++;
+    }
+    auto residue_neighbors = [&] (PROT::Residue * residue, const map<PROT::Residue*, size_t>& members){
+        vector<PROT::Residue*> found = lists.residue_neighbors(residue, 14);
+        vector<PROT::Residue*> neighbors;
+        for (size_t j = 0; j < found.size(); j++){
+            map<PROT::Residue*, size_t>::const_iterator it = members.find(found[j]);
+            if (it != members.end()){
+                neighbors.insert(neighbors.end(), it->second, found[j]);
+            }
+        }
+        return neighbors;
+    };
+    // determine the stability and free rotamers in every context
+    METHODS::parallel_for(contexts.size(), [&] (size_t i) {
+        StabilityContext& context = contexts[i];
+        // get the neighbors of the residue, inter and intra. Their order does
+        // not matter
+        vector<PROT::Residue*> intra_neighbors = residue_neighbors(context.residue, context.side1 ? side1_members : side2_members);
+        vector<PROT::Residue*> inter_neighbors = residue_neighbors(context.residue, all_members);
+        const PROT::Rotamers& rotamers = context.residue->rotamers();
+        context.free_rot_pre = context.residue->free_rotamers(rotamers, intra_neighbors);
+        context.free_rot_bound = context.residue->free_rotamers(rotamers, inter_neighbors);
+        context.prestable = context.residue->stable(rotamers.size(), context.free_rot_pre, intra_neighbors, false);
+        context.bound_stable = context.residue->stable(rotamers.size(), context.free_rot_bound, inter_neighbors, false);
+    });
+
+    // a residue in several interactions is reported with the stability of its
+    // last one
+    map<PROT::Residue*, bool> prestable;
+    map<PROT::Residue*, bool> bound_stable;
+    size_t c = 0;
+    auto record_stability = [&] (bool backbone, size_t& free_rot_pre, size_t& free_rot_bound){
+        StabilityContext& context = contexts[interaction_contexts[c++]];
+        prestable[context.residue] = backbone || context.prestable;
+        bound_stable[context.residue] = backbone || context.bound_stable;
+        free_rot_pre = context.free_rot_pre;
+        free_rot_bound = context.free_rot_bound;
+    };
+    for (size_t i = 0; i < hbonds.size(); i++){
+        record_stability(hbonds[i].donor_backbone, hbonds[i].donor_free_rot_pre, hbonds[i].donor_free_rot_bound);
+        record_stability(hbonds[i].acceptor_backbone, hbonds[i].acceptor_free_rot_pre, hbonds[i].acceptor_free_rot_bound);
+    }
+    for (size_t i = 0; i < salt_bridges.size(); i++){
+        record_stability(salt_bridges[i].donor_backbone, salt_bridges[i].donor_free_rot_pre, salt_bridges[i].donor_free_rot_bound);
+        record_stability(salt_bridges[i].acceptor_backbone, salt_bridges[i].acceptor_free_rot_pre, salt_bridges[i].acceptor_free_rot_bound);
+    }
+    for (size_t i = 0; i < hydrophobic_interactions.size(); i++){
+        record_stability(hydrophobic_interactions[i].res1_backbone, hydrophobic_interactions[i].res1_free_rot_pre, hydrophobic_interactions[i].res1_free_rot_bound);
+        record_stability(hydrophobic_interactions[i].res2_backbone, hydrophobic_interactions[i].res2_free_rot_pre, hydrophobic_interactions[i].res2_free_rot_bound);
     }
 
     // make the output directory if it doesnt exist
@@ -244,13 +297,13 @@ void EPPI::calculate_eppi_features(vector<PROT::Protein*>& proteins, string& int
         features_file<<"Hydrogen Bond ";
         features_file<<hbonds[i].donor_residue->name()<<"_"<<hbonds[i].donor_residue->number()<<"_"<<hbonds[i].donor_residue->protein()<< " ";
         // if prestable
-        if (hbonds[i].donor_residue->prestable()){
+        if (prestable[hbonds[i].donor_residue]){
             features_file<<"prestable ";
         } else {
             features_file<<"not_prestable ";
         }
         // if bound_stable
-        if (hbonds[i].donor_residue->bound_stable()){
+        if (bound_stable[hbonds[i].donor_residue]){
             features_file<<"bound_stable ";
         } else {
             features_file<<"not_bound_stable ";
@@ -265,13 +318,13 @@ void EPPI::calculate_eppi_features(vector<PROT::Protein*>& proteins, string& int
         features_file<<hbonds[i].donor_free_rot_bound<<" ";
         features_file<<", ";
         features_file<<hbonds[i].acceptor_residue->name()<<"_"<<hbonds[i].acceptor_residue->number()<<"_"<<hbonds[i].acceptor_residue->protein()<< " ";
-        if (hbonds[i].acceptor_residue->prestable()){
+        if (prestable[hbonds[i].acceptor_residue]){
             features_file<<"prestable ";
         } else {
             features_file<<"not_prestable ";
         }
         // if bound_stable
-        if (hbonds[i].acceptor_residue->bound_stable()){
+        if (bound_stable[hbonds[i].acceptor_residue]){
             features_file<<"bound_stable ";
         } else {
             features_file<<"not_bound_stable ";
@@ -293,13 +346,13 @@ void EPPI::calculate_eppi_features(vector<PROT::Protein*>& proteins, string& int
         features_file<<"Salt Bridge ";
         features_file<<salt_bridges[i].donor_residue->name()<<"_"<<salt_bridges[i].donor_residue->number()<<"_"<<salt_bridges[i].donor_residue->protein()<< " ";
         // if prestable
-        if (salt_bridges[i].donor_residue->prestable()){
+        if (prestable[salt_bridges[i].donor_residue]){
             features_file<<"prestable ";
         } else {
             features_file<<"not_prestable ";
         }
         // if bound_stable
-        if (salt_bridges[i].donor_residue->bound_stable()){
+        if (bound_stable[salt_bridges[i].donor_residue]){
             features_file<<"bound_stable ";
         } else {
             features_file<<"not_bound_stable ";
@@ -314,13 +367,13 @@ void EPPI::calculate_eppi_features(vector<PROT::Protein*>& proteins, string& int
         features_file<<salt_bridges[i].donor_free_rot_bound<<" ";
         features_file<<", ";
         features_file<<salt_bridges[i].acceptor_residue->name()<<"_"<<salt_bridges[i].acceptor_residue->number()<<"_"<<salt_bridges[i].acceptor_residue->protein()<< " ";
-        if (salt_bridges[i].acceptor_residue->prestable()){
+        if (prestable[salt_bridges[i].acceptor_residue]){
             features_file<<"prestable ";
         } else {
             features_file<<"not_prestable ";
         }
         // if bound_stable
-        if (salt_bridges[i].acceptor_residue->bound_stable()){
+        if (bound_stable[salt_bridges[i].acceptor_residue]){
             features_file<<"bound_stable ";
         } else {
             features_file<<"not_bound_stable ";
@@ -341,13 +394,13 @@ void EPPI::calculate_eppi_features(vector<PROT::Protein*>& proteins, string& int
         features_file<<"Hydrophobic Interaction ";
         features_file<<hydrophobic_interactions[i].res1->name()<<"_"<<hydrophobic_interactions[i].res1->number()<<"_"<<hydrophobic_interactions[i].res1->protein()<< " ";
         // if prestable
-        if (hydrophobic_interactions[i].res1->prestable()){
+        if (prestable[hydrophobic_interactions[i].res1]){
             features_file<<"prestable ";
         } else {
             features_file<<"not_prestable ";
         }
         // if bound_stable
-        if (hydrophobic_interactions[i].res1->bound_stable()){
+        if (bound_stable[hydrophobic_interactions[i].res1]){
             features_file<<"bound_stable ";
         } else {
             features_file<<"not_bound_stable ";
@@ -362,13 +415,13 @@ void EPPI::calculate_eppi_features(vector<PROT::Protein*>& proteins, string& int
         features_file<<hydrophobic_interactions[i].res1_free_rot_bound<<" ";
         features_file<<", ";
         features_file<<hydrophobic_interactions[i].res2->name()<<"_"<<hydrophobic_interactions[i].res2->number()<<"_"<<hydrophobic_interactions[i].res2->protein()<< " ";
-        if (hydrophobic_interactions[i].res2->prestable()){
+        if (prestable[hydrophobic_interactions[i].res2]){
             features_file<<"prestable ";
         } else {
             features_file<<"not_prestable ";
         }
         // if bound_stable
-        if (hydrophobic_interactions[i].res2->bound_stable()){
+        if (bound_stable[hydrophobic_interactions[i].res2]){
             features_file<<"bound_stable ";
         } else {
             features_file<<"not_bound_stable ";
@@ -63,6 +63,64 @@ PROT::PDB METHODS::make_mutation(PROT::PDB * pdb, string& mutation, string& outp
     return PROT::PDB(output_path+"/mutation_" + mutation + "_minimized.pdb");
 }
 
+// mutation function (mutation -> DA26A <old><chain><residue number><new>). The
+// wild type snapshot is not changed, and the mutant is materialized into its
+// own proteins for the minimization
+vector<PROT::Protein> METHODS::make_mutation(const PROT::Snapshot& wild_type, string& mutation, string& output_path){
+    char mutant_res = mutation[0];
+    char mutant_chain = mutation[1];
+    int mutant_res_num = std::stoi(mutation.substr(2, mutation.size() - 3));
+    char new_res_char = mutation.back();
+
+    // make the output path
+    system(("mkdir -p " + output_path).c_str());
+
+    // convert new res to 3 letter code
+    string new_res;
+    for (size_t i = 0; i < PROT::AA1.size(); i++) {
+        if (PROT::AA1[i][0] == new_res_char) {
+            new_res = PROT::AA3[i];
+            break;
+        }
+    }
+
+    ofstream output (output_path+"/log.txt");
+    // find the residue to mutate
+    PROT::Snapshot mutant = wild_type;
+    PROT::Residue* res = 0;
+    for (size_t i = 0; i < mutant.proteins(); i++) {
+        for (size_t j = 0; j < mutant.size(i); j++) {
+            const PROT::Residue& residue = mutant.residue(i, j);
+            if (residue.protein() == mutant_chain && residue.AA1() == mutant_res && residue.number() == mutant_res_num) {
+                res = mutant.modify(i, j);
+                break;
+            }
+        }
+    }
+    if (res == 0) {
+        string error = "The residue of mutation " + mutation + " was not found.\n";
+        throw PANTZ_error (error);
+    }
+    // rename the residue
+    res->remove_sidechain();
+    res->rename(new_res);
+
+    // the minimization changes every residue, so it gets its own proteins
+    vector<PROT::Protein> proteins = mutant.materialize();
+    // run a minimization with all residues fixed except the mutated residue
+    vector<int> fixed_residues;
+    int fix_res = Rosetta::get_pose_numbering(proteins, mutant_chain, mutant_res_num);
+    fixed_residues.push_back(fix_res);
+    Rosetta::Energy_Minimization_fixed_res(proteins, output, output_path, fixed_residues);
+    // write to a file
+    ofstream mutated_file_minimized (output_path+"/mutation_" + mutation + "_minimized.pdb");
+    for (size_t i = 0; i < proteins.size(); i++) {
+        mutated_file_minimized<<proteins[i].str()<<endl;
+    }
+    mutated_file_minimized.close();
+    return proteins;
+}
+
 // mutation function (mutation -> DA26A <old><chain><residue number><new>) (interface -> A_BC <chain(s)>_<chain(s)>)
 vector<PROT::Protein> METHODS::make_mutation(vector<PROT::Protein>& proteins, string& mutation, string& output_path){
     char mutant_res = mutation[0];
@@ -83,8 +141,8 @@ vector<PROT::Protein> METHODS::make_mutation(vector<PROT::Protein>& proteins, st
     }
 
     ofstream output (output_path+"/log.txt");
-    // make the mutation
-    PROT::Residue* res;
+    // make the mutation in the provided proteins
+    PROT::Residue* res = 0;
     for (size_t i = 0; i < proteins.size(); i++) {
         for (size_t j = 0; j < proteins[i].size(); j++) {
             if (proteins[i].operator()(j, ' ', true)->protein() == mutant_chain && proteins[i].operator()(j, ' ', true)->AA1() == mutant_res && proteins[i].operator()(j, ' ', true)->number() == mutant_res_num) {
@@ -93,6 +151,10 @@ vector<PROT::Protein> METHODS::make_mutation(vector<PROT::Protein>& proteins, st
             }
         }
     }
+    if (res == 0) {
+        string error = "The residue of mutation " + mutation + " was not found.\n";
+        throw PANTZ_error (error);
+    }
     // rename the residue
     res->remove_sidechain();
     res->rename(new_res);
@@ -109,4 +171,4 @@ vector<PROT::Protein> METHODS::make_mutation(vector<PROT::Protein>& proteins, st
     }
     mutated_file_minimized.close();
     return proteins;
-}
\ No newline at end of file
+}
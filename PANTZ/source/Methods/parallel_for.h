@@ -0,0 +1,62 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file implements the methods that spread independent pieces of work
+ * over several threads. The number of threads is controlled by the
+ * PANTZ_THREADS macro in Macros.h. */
+
+// This file is supposed to be included by Methods.h
+#ifndef Methods_Loading_Status
+#error Methods::parallel_for.h must be included by Methods.h
+#endif
+
+// Include the standard C++ threading files
+#include <atomic>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+// The number of threads that parallel calculations should use
+size_t METHODS::thread_count () {
+    size_t count = PANTZ_THREADS;
+    // A value of 0 means that every available core should be used
+    if (count == 0) {count = thread::hardware_concurrency();}
+    // The hardware is not required to report its number of cores
+    if (count == 0) {count = 1;}
+    return count;
+}
+
+// Call the function once for every index from 0 up to (but not including) the
+// count. The indices are handed out to the threads one at a time, so the
+// function must only change information that belongs to its own index.
+void METHODS::parallel_for (const size_t count, const function<void(size_t)>& work) {
+    // There is no point in having more threads than pieces of work
+    size_t threads = thread_count();
+    if (threads > count) {threads = count;}
+    // If there is only one thread, do the work here
+    if (threads <= 1) {
+        for(size_t i=0; i<count; ++i) {work(i);}
+        return;}
+    // The next index to hand out
+    atomic<size_t> next (0);
+    // Whether or not any thread has failed
+    atomic<bool> failed (false);
+    // The first error that was encountered, which is passed on to the caller
+    // once all of the threads have finished
+    exception_ptr error;
+    mutex error_lock;
+    auto worker = [&] () {
+        while (!failed) {
+            size_t i = next++;
+            if (i >= count) {break;}
+            try {work(i);}
+            catch (...) {
+                lock_guard<mutex> lock (error_lock);
+                if (!error) {error = current_exception();}
+                failed = true;}}};
+    // Start the extra threads, and have this thread do work too
+    vector<thread> pool;
+    for(size_t i=1; i<threads; ++i) {pool.push_back(thread(worker));}
+    worker();
+    for(size_t i=0; i<pool.size(); ++i) {pool[i].join();}
+    if (error) {rethrow_exception(error);}
+}
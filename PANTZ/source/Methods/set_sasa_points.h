@@ -1,8 +1,8 @@
 /* Created by clay at Auburn University.
 *
 * This file implements the functions to set the m_sasa_points for 
-* all atoms in a given vector of atoms. It makes a kd tree of the
-* atoms and then sets the sasa points for each atom.
+* all atoms in a given vector of atoms. It puts the atoms into a
+* grid and then sets the sasa points for each atom.
 *
 */
 
@@ -11,19 +11,22 @@
 #error General Methods must be included by Methods.h
 #endif
 
-// include the KDtree class
-#include "../PROT/KDtree.h"
+// include the Grid class
+#include "../PROT/Grid.h"
 
 
 // a function to set the sasa points for all atoms in a given vector of atoms 
 // (the points on the atoms that are not buried by other atoms)
 void METHODS::set_sasa_points(vector<PROT::Atom*> atoms){
-    // create a KDtree of the atoms
-    PROT::KDtree<PROT::Atom> kd_tree(atoms);
+    // put the atoms into a grid whose cells are as wide as the search
+    // distance, so each search only looks at the 27 cells around an atom
+    PROT::Grid<PROT::Atom> grid(atoms, 8.0);
     // set the sasa points on the atoms in the 
-    for (auto atom : atoms) {
-        // get neighbors of the atom
-        vector<PROT::Atom*> neighbors = kd_tree.radius_neighbors(atom, 8.0);
+    for (size_t i = 0; i < atoms.size(); i++) {
+        PROT::Atom* atom = atoms[i];
+        // get neighbors of the atom. Any neighbor can bury a point, so they do
+        // not need to be sorted
+        vector<PROT::Atom*> neighbors = grid.radius_neighbors(atom, 8.0);
         // get the mesh points of the atom (with vdw radius)
         vector<vector<float>> mesh = atom->fibonacci_sphere(80, 1.4);
         // loop through the points in the mesh
@@ -0,0 +1,137 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file contains the declaration and implementation of the Arena class. An
+ * Arena hands out memory from a few large chunks instead of asking the system
+ * for each object, and releases all of it at once when it is reset. Objects
+ * that need their destructors run are remembered and destroyed by the reset.
+ * After a reset the chunks are kept, so an Arena that is reset between the
+ * members of a batch stops asking the system for memory once it has grown to
+ * the size one member needs. */
+
+// Use a header guard to make sure this file is only included in a compiled
+// program a single time
+#ifndef Proteins_Arena_Guard
+#define Proteins_Arena_Guard 1
+
+// Make sure this file is being included from the Proteins.h header file
+#ifndef Proteins_Loading_Status
+#error Arena.h must be included by Proteins.h
+#endif
+
+// Objects are constructed in place and only destroyed if they need to be
+#include <cstdint>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Define the Arena class
+class PROT::Arena {
+
+    // The information stored in the class is private
+    private:
+        // A block of memory and its size in bytes
+        struct Chunk {
+            char * data;
+            size_t size;
+        };
+        // The chunks, the one that memory is currently taken from and how
+        // many of its bytes have been used
+        vector<Chunk> m_chunks;
+        size_t m_current;
+        size_t m_used;
+        // The size of a new chunk, unless an object needs a bigger one
+        size_t m_chunk_size;
+        // An object that has to be destroyed when the Arena is reset
+        struct Destructor {
+            void (*destroy) (void *);
+            void * object;
+        };
+        vector<Destructor> m_destructors;
+        // Destroy an object of a type
+        template<class T>
+        static void destroy (void * object) {static_cast<T *>(object)->~T();}
+        // Delete the chunks
+        void release ();
+        // An Arena owns its memory, so it can not be copied
+        Arena (const Arena&);
+        Arena& operator= (const Arena&);
+
+    // The public interface of the class
+    public:
+        // Make an Arena whose chunks are at least a number of bytes
+        explicit Arena (const size_t chunk_size = 65536) {
+            m_current = 0; m_used = 0; m_chunk_size = chunk_size;}
+        // Destroy the objects and delete the memory
+        ~Arena () {reset(); release();}
+        // Get a number of bytes with an alignment
+        void * allocate (const size_t, const size_t);
+        // Make an object in the Arena. It is destroyed when the Arena is reset
+        template<class T, class... Args>
+        T * make (Args&&... args) {
+            void * place = allocate(sizeof(T), alignof(T));
+            T * object = new (place) T (std::forward<Args>(args)...);
+            if (!is_trivially_destructible<T>::value) {
+                Destructor d; d.destroy = &destroy<T>; d.object = object;
+                m_destructors.push_back(d);}
+            return object;}
+        // Destroy every object and make all of the memory available again
+        void reset ();
+        // The number of bytes held by the Arena
+        size_t capacity () const {
+            size_t total = 0;
+            for(size_t i=0; i<m_chunks.size(); ++i) {total += m_chunks[i].size;}
+            return total;}
+
+    // End the class definition
+};
+
+// Delete every chunk
+void PROT::Arena::release () {
+    for(size_t i=0; i<m_chunks.size(); ++i) {delete [] m_chunks[i].data;}
+    m_chunks.clear();
+    m_current = 0;
+    m_used = 0;
+}
+
+// Get memory for an object. It comes from the current chunk if there is room,
+// otherwise from the next chunk that is big enough, which is made if needed
+void * PROT::Arena::allocate (const size_t bytes, const size_t alignment) {
+    while (m_current < m_chunks.size()) {
+        const Chunk& chunk = m_chunks[m_current];
+        uintptr_t start = reinterpret_cast<uintptr_t>(chunk.data) + m_used;
+        size_t padding = (alignment - start % alignment) % alignment;
+        if (m_used + padding + bytes <= chunk.size) {
+            m_used += padding + bytes;
+            return chunk.data + m_used - bytes;}
+        ++m_current;
+        m_used = 0;}
+    Chunk chunk;
+    chunk.size = m_chunk_size;
+    if (chunk.size < bytes + alignment) {chunk.size = bytes + alignment;}
+    chunk.data = new char [chunk.size];
+    m_chunks.push_back(chunk);
+    m_current = m_chunks.size() - 1;
+    m_used = 0;
+    return allocate(bytes, alignment);
+}
+
+// Destroy the objects, newest first, and start using the memory again. If the
+// objects needed several chunks, they are replaced by one chunk that is as big
+// as all of them, so the next set of objects of the same size fits in it
+void PROT::Arena::reset () {
+    for(size_t i=m_destructors.size(); i>0; --i) {
+        m_destructors[i-1].destroy(m_destructors[i-1].object);}
+    m_destructors.clear();
+    if (m_chunks.size() > 1) {
+        size_t total = capacity();
+        release();
+        Chunk chunk;
+        chunk.size = total;
+        chunk.data = new char [chunk.size];
+        m_chunks.push_back(chunk);}
+    m_current = 0;
+    m_used = 0;
+}
+
+// End the header guard from the start of the file
+#endif
@@ -23,6 +23,9 @@
 #error Atom.h must be included after Matrix.h
 #endif
 
+// The solvent accessible points are stored as fixed size arrays
+#include <array>
+
 // Define the Atom class
 class PROT::Atom {
 
@@ -31,30 +34,37 @@ class PROT::Atom {
     friend class PROT::Residue;
     // The PDB class also needs to be a friend
     friend class PROT::PDB;
+    // And the Protein class, which packs the coordinates of its Atoms together
+    friend class PROT::Protein;
 
     // The information stored in the class is private
     private:
-        // The Atom's coordinates
-        coor m_coors [AtomCoordinates];
-        // ATOM or HETATM at the start of the line
-        string m_type;
-        // The atom's name
-        string m_name;
-        // The name of the atom's residue
-        string m_residue;
-        // The atom's chemical element
-        string m_element;
-        // The atom's charge (often missing, so stored as a string)
-        string m_charge;
-        // The atom's number
-        long m_number;
-        // The residue's number
-        long m_residue_number;
+        // The Atom's coordinates. They are either the Atom's own or a place in
+        // the coordinate buffer of the Protein that contains the Atom
+        coor * m_coors;
+        coor m_own [AtomCoordinates];
         // The occupancy of the atom in the PDB file (x-ray crystallography
         // property)
         float m_occupancy;
         // The temperature factur
         float m_temperature;
+        // The atom's number
+        long m_number;
+        // The residue's number
+        long m_residue_number;
+        // The atom's name, the name of its residue, its chemical element and
+        // its charge (often missing), as interned Names
+        Names::ID m_name;
+        Names::ID m_residue;
+        Names::ID m_element;
+        Names::ID m_charge;
+        // The Atom's chemistry flags and the class of its Lennard Jones radius.
+        // They only depend on its name, its residue's name and its element, and
+        // are set by the classify method whenever one of those changes
+        uint8_t m_flags;
+        uint8_t m_radius;
+        // Whether the line started with HETATM instead of ATOM
+        bool m_hetatm;
         // The alternate location specifier for the atom's residue. This is
         // related to but not the same as the occupancy
         char m_alt;
@@ -63,15 +73,45 @@ class PROT::Atom {
         // The atom's residue's protein's name
         char m_protein;
         // the atoms solvent accesible points (set by METHODS::set_sasa_points)
-        vector<vector<float>> m_sasa_points;
+        vector<array<float, 3>> m_sasa_points;
 
     // Private methods to control class behavior
     private:
         // Assign default values to the class variables
         void initialize();
-        // Copy information from another instance of the class
+        // Copy information from another instance of the class. The coordinates
+        // are copied into wherever this Atom keeps its coordinates
         void copy (const Atom *);
         void copy (const Atom& other) {copy(&other);}
+        // Take the information from an Atom that is about to be destroyed
+        void take (Atom&);
+        // Keep the coordinates at a place in a Protein's coordinate buffer,
+        // or go back to keeping them in the Atom itself
+        void bind (coor * place) {
+            for(size_t i=0; i<AtomCoordinates; ++i) {place[i] = m_coors[i];}
+            m_coors = place;}
+        void detach () {
+            if (m_coors == m_own) {return;}
+            for(size_t i=0; i<AtomCoordinates; ++i) {m_own[i] = m_coors[i];}
+            m_coors = m_own;}
+        // Read the Atom from the text of a PDB file line, returning false
+        // instead of throwing an error if it is not an acceptable Atom
+        bool read (const char *, const size_t);
+        // Read the Atom from the values of an mmCIF _atom_site row, which are
+        // empty if they are missing from the row. The values are not limited
+        // to what fits in the columns of a PDB file line
+        bool read (const vector<string>&);
+        // Set the Atom's chemistry flags and radius class from its names
+        void classify ();
+        // Whether or not the Atom's name is that of a hydrogen
+        bool name_is_hydrogen () const;
+        // Change the Atom's name, its residue's name or its element and update
+        // its chemistry flags to match
+        void set_name (const Names::ID id) {m_name = id; classify();}
+        void set_residue (const Names::ID id) {m_residue = id; classify();}
+        void set_element (const Names::ID id) {m_element = id; classify();}
+        // The radius class of an Atom whose element has no known radius
+        static const uint8_t UnknownRadius = 5;
         // Move the Atom without confirming the validity of the matrix for that
         // purpose
         void private_move (const Matrix *, const char);
@@ -89,20 +129,35 @@ class PROT::Atom {
 
     // The public interface of the class
     public:
+        // The values of an mmCIF _atom_site row that an Atom is read from
+        enum SiteValue {SiteGroup, SiteNumber, SiteElement, SiteName, SiteAlt,
+                        SiteResidue, SiteProtein, SiteResidueNumber,
+                        SiteInsertion, SiteX, SiteY, SiteZ, SiteOccupancy,
+                        SiteTemperature, SiteCharge, SiteModel, SiteValues};
         // The default class constructor
         Atom () {initialize();}
         // The standard constructor
         Atom (const string&);
-        // Copy construction and assignment
-        Atom (const Atom& other) {copy(other);}
-        void operator= (const Atom& other) {copy(other);}
+        // Copy construction and assignment. A copied Atom always keeps its
+        // own coordinates
+        Atom (const Atom& other) {m_coors = m_own; copy(other);}
+        Atom& operator= (const Atom& other) {copy(other); return *this;}
+        // Move construction and assignment
+        Atom (Atom&& other) noexcept {m_coors = m_own; take(other);}
+        Atom& operator= (Atom&& other) noexcept {
+            if (this != &other) {take(other);}
+            return *this;}
         // Access to class attributes
         size_t size () const {return AtomCoordinates;}
-        string type () const {return m_type;}
-        string name () const {return m_name;}
-        string residue () const {return m_residue;}
-        string element () const {return m_element;}
-        string charge () const {return m_charge;}
+        string type () const {if (m_hetatm) {return "HETATM";} return "ATOM";}
+        const string& name () const {return Names::text(m_name);}
+        const string& residue () const {return Names::text(m_residue);}
+        const string& element () const {return Names::text(m_element);}
+        const string& charge () const {return Names::text(m_charge);}
+        // The interned IDs of the names, which can be compared directly
+        Names::ID name_id () const {return m_name;}
+        Names::ID residue_id () const {return m_residue;}
+        Names::ID element_id () const {return m_element;}
         long number () const {return m_number;}
         long residue_number () const {return m_residue_number;}
         float occupancy () const {return m_occupancy;}
@@ -110,6 +165,8 @@ class PROT::Atom {
         char alternative_location () const {return m_alt;}
         char insertion_code () const {return m_insertion;}
         char protein () const {return m_protein;}
+        // The atom's coordinates, x y and z in a row
+        const coor * coordinates () const {return m_coors;}
         // Access to the atom's coordinates
         coor operator[] (const size_t) const;
         coor operator[] (const char) const;
@@ -118,10 +175,15 @@ class PROT::Atom {
         // Create a PDB formatted string of the Atom's data that is appropriate
         // for use in Rosetta
         string rosetta_str () const;
+        // The chemistry flags an Atom can have. They are set when the Atom is
+        // made and whenever it or its residue is renamed
+        enum Flag {Backbone = 1, Hydrogen = 2, Polar = 4, Charged = 8,
+                   Donor = 16, Acceptor = 32};
+        bool is (const Flag flag) const {return (m_flags & flag) != 0;}
         // Whether or not the Atom is a backbone atom
-        bool is_backbone_atom () const {return CHECK::is_backbone_atom(m_name);}
+        bool is_backbone_atom () const {return is(Backbone);}
         // Whether or not the atom is a hydrogen
-        bool is_hydrogen () const;
+        bool is_hydrogen () const {return is(Hydrogen);}
         // The chemical element of the atom (the first non-digit character of
         // it's name). This function is implemented in the is_hydrogen header
         // file
@@ -148,10 +210,14 @@ class PROT::Atom {
         float distance (const Atom& other) const {return calculate_distance(other, false);}
         // the sigma value for the atom
         float lj_sigma() const;
+        // the largest sigma value of any element
+        static float max_lj_sigma() {return 1.782;}
         // the sphere around the atom (for interaction calculations)
         vector<vector<float>> fibonacci_sphere (size_t N, float probe_radius);
         // set sasa points to the atom
-        void add_sasa_point (vector<float> point) {m_sasa_points.push_back(point);}
+        void add_sasa_point (const vector<float>& point) {
+            array<float, 3> stored = {{point[0], point[1], point[2]}};
+            m_sasa_points.push_back(stored);}
         // check if atoms are sterically clashing
         bool clash (Atom*, float probe_radius = 0);
 
@@ -210,6 +276,7 @@ class PROT::AtomPtr {
         string rosetta_str () const {check(); return m_ptr->rosetta_str();}
         bool is_backbone_atom () const {check(); return m_ptr->is_backbone_atom();}
         bool is_hydrogen () const {check(); return m_ptr->is_hydrogen();}
+        bool is (const Atom::Flag flag) const {check(); return m_ptr->is(flag);}
         char determine_element () const {check(); return m_ptr->determine_element();}
         void update_name_for_Rosetta (const bool last = false) const {
             check (); m_ptr->update_name_for_Rosetta(last);}
@@ -239,9 +306,11 @@ class PROT::AtomPtr {
 #include "Atom/move.h"
 #include "Atom/rotate.h"
 #include "Atom/constructor.h"
+#include "Atom/read.h"
 #include "Atom/operator.h"
 #include "Atom/str.h"
 #include "Atom/is_hydrogen.h"
+#include "Atom/classify.h"
 // added by clay
 #include "Atom/calculate_distance.h"
 #include "Atom/update_name.h"
@@ -8,14 +8,21 @@
 #error Atom methods must be included from the Atom.h header file
 #endif 
 
-// Calculate the dihedral angle between 4 atoms
-PROT::coor PROT::calculate_dihedral (const Atom * atom1, const Atom * atom2,
-                                     const Atom * atom3, const Atom * atom4) {
-    // Make vectors of the differences between certain atoms
-    Matrix f = Matrix(atom1) - Matrix(atom2); f.make_unit_vector();
-    Matrix g = Matrix(atom2) - Matrix(atom3); g.make_unit_vector();
+// Calculate the dihedral angle between 4 points, each given by an array of
+// coordinates
+PROT::coor PROT::calculate_dihedral (const coor * point1, const coor * point2,
+                                     const coor * point3, const coor * point4) {
+    // Store the points in matrices
+    Matrix p1 (1, AtomCoordinates), p2 (1, AtomCoordinates);
+    Matrix p3 (1, AtomCoordinates), p4 (1, AtomCoordinates);
+    for(size_t i=0; i<AtomCoordinates; ++i) {
+        p1.set(0, i, point1[i]); p2.set(0, i, point2[i]);
+        p3.set(0, i, point3[i]); p4.set(0, i, point4[i]);}
+    // Make vectors of the differences between certain points
+    Matrix f = p1 - p2; f.make_unit_vector();
+    Matrix g = p2 - p3; g.make_unit_vector();
     // This is supposed to be 4 - 3
-    Matrix h = Matrix(atom4) - Matrix(atom3); h.make_unit_vector();
+    Matrix h = p4 - p3; h.make_unit_vector();
     // Calculate cross products between the vectors
     Matrix a = f.crossProduct(g); a.make_unit_vector();
     Matrix b = h.crossProduct(g); b.make_unit_vector(); b = b.transpose();
@@ -31,6 +38,17 @@ PROT::coor PROT::calculate_dihedral (const Atom * atom1, const Atom * atom2,
     return angle;
 }
 
+// Calculate the dihedral angle between 4 atoms
+PROT::coor PROT::calculate_dihedral (const Atom * atom1, const Atom * atom2,
+                                     const Atom * atom3, const Atom * atom4) {
+    coor point1 [AtomCoordinates], point2 [AtomCoordinates];
+    coor point3 [AtomCoordinates], point4 [AtomCoordinates];
+    for(size_t i=0; i<AtomCoordinates; ++i) {
+        point1[i] = atom1->operator[](i); point2[i] = atom2->operator[](i);
+        point3[i] = atom3->operator[](i); point4[i] = atom4->operator[](i);}
+    return calculate_dihedral(point1, point2, point3, point4);
+}
+
 // Do the same, using 4 atoms passed by reference
 PROT::coor PROT::calculate_dihedral (const Atom& atom1, const Atom& atom2,
                                      const Atom& atom3, const Atom& atom4) {
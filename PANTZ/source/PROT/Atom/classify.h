@@ -0,0 +1,59 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file contains the classify method of the Atom class, which works out an
+ * Atom's chemistry flags and Lennard Jones radius class. The flags come from
+ * the same chemistry tables that the Residue's interaction methods use, so that
+ * they always agree with those methods. */
+
+// Confirm that the Atom class has been declared and is actively being loaded
+#ifndef Atom_Loading_Status
+#error Atom methods must be included from the Atom.h header file
+#endif
+
+// Set the chemistry flags and radius class of the Atom. They only depend on the
+// Atom's name, its residue's name and its element, so each combination of those
+// is only worked out once by each thread
+void PROT::Atom::classify () {
+    static thread_local unordered_map<uint64_t, uint16_t> known;
+    uint64_t key = (uint64_t(m_residue) << 32) | (uint64_t(m_name) << 16) | m_element;
+    unordered_map<uint64_t, uint16_t>::const_iterator it = known.find(key);
+    if (it != known.end()) {
+        m_flags = it->second & 0xFF;
+        m_radius = it->second >> 8;
+        return;}
+    const string& atom_name = name();
+    const string& residue_name = residue();
+    m_flags = 0;
+    if (CHECK::is_backbone_atom(atom_name)) {m_flags |= Backbone;}
+    if (name_is_hydrogen()) {m_flags |= Hydrogen;}
+    // Polar atoms, as the hydrophobic interaction method identifies them
+    AminoAcid amino = amino_acid(residue_name);
+    if ((amino != NotAminoAcid) && listed(PolarAtoms[amino], atom_name)) {
+        m_flags |= Polar;}
+    // Atoms of charged groups
+    if (((amino != NotAminoAcid) && listed(ChargedAtoms[standard(amino)], atom_name)) ||
+        listed(TerminalAtoms, atom_name)) {
+        m_flags |= Charged;}
+    // Hydrogens that can be donated and the atoms that can accept them, matched
+    // the same way the hydrogen bond method matches them
+    if (amino != NotAminoAcid) {
+        if (m_element == Names::H) {
+            const HBondGroups& donors = HBondDonors[standard(amino)];
+            for(size_t i=0; i<donors.count; ++i) {
+                if (Text::contains(atom_name, donors.groups[i].atom)) {
+                    m_flags |= Donor; break;}}}
+        if ((m_element == Names::O) || (m_element == Names::N)) {
+            const HBondGroups& acceptors = HBondAcceptors[standard(amino)];
+            for(size_t i=0; i<acceptors.count; ++i) {
+                if (Text::contains(atom_name, acceptors.groups[i].atom)) {
+                    m_flags |= Acceptor; break;}}}}
+    // The radius class follows the order of the radii in lj_sigma
+    switch (m_element) {
+        case Names::H: m_radius = 0; break;
+        case Names::C: m_radius = 1; break;
+        case Names::N: m_radius = 2; break;
+        case Names::O: m_radius = 3; break;
+        case Names::S: m_radius = 4; break;
+        default: m_radius = UnknownRadius;}
+    known[key] = m_flags | (uint16_t(m_radius) << 8);
+}
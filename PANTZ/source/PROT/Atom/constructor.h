@@ -12,6 +12,10 @@
 PROT::Atom::Atom (const string& input) {
     // Assign initial values to the Atom
     initialize ();
+    // Acceptable lines are read in place. Only a line that is not acceptable
+    // is analyzed again to explain what is wrong with it
+    if (read(input.c_str(), input.size())) {return;}
+    initialize ();
     // Create a copy of the string that can be modified and analyzed
     string line = input;
     // Strip the whitespace and convert it to all capital letters
@@ -23,8 +27,8 @@ PROT::Atom::Atom (const string& input) {
             string error = "This text is too short to contain a PDB atom.\n";
             throw PANTZ_error (error);}
         // Determine the Atom's type
-        if (Text::startswith(line, "ATOM  ")) {m_type = "ATOM";}
-        else if (Text::startswith(line, "HETATM")) {m_type = "HETATM";}
+        if (Text::startswith(line, "ATOM  ")) {m_hetatm = false;}
+        else if (Text::startswith(line, "HETATM")) {m_hetatm = true;}
         else {
             string error = "PDB atom lines must start with ATOM or HETATM.\n";
             throw PANTZ_error (error);}
@@ -37,14 +41,16 @@ PROT::Atom::Atom (const string& input) {
             string error = "Columns 7-11 do not contain an integer.\n";
             throw PANTZ_error (error);}
         // Get the Atom's name
-        m_name = line.substr(12, 4); Text::strip(m_name);
-        CHECK::atom_name(m_name);
+        value = line.substr(12, 4); Text::strip(value);
+        CHECK::atom_name(value);
+        m_name = Names::intern(value);
         // Get the alternative location information
         m_alt = line[16];
         CHECK::alt_location(m_alt);
         // Get the residue's name
-        m_residue = line.substr(17, 3); Text::strip(m_residue);
-        CHECK::residue_name (m_residue);
+        value = line.substr(17, 3); Text::strip(value);
+        CHECK::residue_name (value);
+        m_residue = Names::intern(value);
         // Get the Protein's name
         m_protein = line[21];
         CHECK::protein_name(m_protein);
@@ -87,11 +93,15 @@ PROT::Atom::Atom (const string& input) {
             throw PANTZ_error (error);}
         // The element and charge information may not be present
         if (line.size() >= 78) {
-            m_element = line.substr(76, 2); Text::strip(m_element);
-            CHECK::element(m_element);
+            value = line.substr(76, 2); Text::strip(value);
+            CHECK::element(value);
+            m_element = Names::intern(value);
             if (line.size() >= 80) {
-                m_charge = line.substr(78, 2); Text::strip(m_charge);
-                CHECK::charge (m_charge);}}
+                value = line.substr(78, 2); Text::strip(value);
+                CHECK::charge (value);
+                m_charge = Names::intern(value);}}
+        // Work out the chemistry flags from the names
+        classify();
     // Catch and handle any errors that occurred during this process
     } catch (PANTZ_error& e) {
         // Store the initial input and strip it of whitespace
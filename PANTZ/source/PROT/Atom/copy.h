@@ -1,7 +1,8 @@
 /* Created by the Pantazes Lab at Auburn University
  *
  * This file is intended to be included by the Atom.h header file. It contains
- * the pointer-based copy method of the Atom class. */
+ * the pointer-based copy method of the Atom class and the take method that
+ * moves the information out of another Atom. */
 
 // Confirm that the Atom class has been declared and is actively being loaded
 #ifndef Atom_Loading_Status
@@ -12,11 +13,13 @@
 void PROT::Atom::copy (const Atom * other) {
     // Copy all of the attributes
     for(size_t i=0; i<AtomCoordinates; ++i) {m_coors[i] = other->m_coors[i];}
-    m_type = other->m_type;
+    m_hetatm = other->m_hetatm;
     m_name = other->m_name;
     m_residue = other->m_residue;
     m_element = other->m_element;
     m_charge = other->m_charge;
+    m_flags = other->m_flags;
+    m_radius = other->m_radius;
     m_number = other->m_number;
     m_residue_number = other->m_residue_number;
     m_occupancy = other->m_occupancy;
@@ -26,3 +29,11 @@ void PROT::Atom::copy (const Atom * other) {
     m_protein = other->m_protein;
 }
 
+// Take the information from an Atom that is about to be destroyed. Its
+// coordinates are copied, because they may be in its Protein's coordinate
+// buffer, and its solvent accessible points are moved
+void PROT::Atom::take (Atom& other) {
+    copy(&other);
+    m_sasa_points = std::move(other.m_sasa_points);
+    other.m_sasa_points.clear();
+}
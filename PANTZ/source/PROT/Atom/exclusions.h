@@ -33,23 +33,23 @@ int PROT::Atom::exclusions (const Atom * other) const {
         // Proline gets special handling, because its delta carbon is bound to
         // its nitrogen. This opens up the possibility of non-bonded
         // exclusions that aren't available to other amino acids
-        if (m_residue == "PRO") {
+        if (residue() == "PRO") {
             // If this is the delta carbon
-            if (m_name == "CD") {
+            if (name() == "CD") {
                 // If the other atom is C
-                if (other->m_name == "C") {return 3;}
-                else if ((other->m_name == "CA") || (other->m_name == "O")) {
+                if (other->name() == "C") {return 3;}
+                else if ((other->name() == "CA") || (other->name() == "O")) {
                     return 4;}}
             // If this is the Gamma carbon or a delta carbon hydrogen
-            else if ((m_name == "CG") || ((m_name == "HD1") || 
-                     (m_name == "HD2"))) {
+            else if ((name() == "CG") || ((name() == "HD1") || 
+                     (name() == "HD2"))) {
                 // In that case, a non-bonded exclusion of 4 is used with the
                 // C from the previous residue
-                if (other->m_name == "C") {return 4;}}}
+                if (other->name() == "C") {return 4;}}}
         // Even for prolines, if this atom is the beta carbon (or HA1 for
         // glycines) and the other Atom is C, a non-bonded exclusion of 4 is
         // correct
-        if (((m_name == "CB") || (m_name == "HA1")) && (other->m_name == "C")) {
+        if (((name() == "CB") || (name() == "HA1")) && (other->name() == "C")) {
             return 4;}
         // In all other cases where the other atom is in the previous residue,
         // non-bonded exclusions are not appropriate
@@ -58,43 +58,43 @@ int PROT::Atom::exclusions (const Atom * other) const {
     else if (other->m_residue_number == m_residue_number + 1) {
         // If this atom is the beta carbon or HA1 and the next atom is a
         // nitrogen, a non-bonded exclusion of 4 is correct
-        if (((m_name == "CB") || (m_name == "HA1")) && (other->m_name == "N")) {
+        if (((name() == "CB") || (name() == "HA1")) && (other->name() == "N")) {
             return 4;}
         // In all other cases, no non-bonded exclusion is appropriate
         return 0;}
     // If the function has reached this point, we know that the the two Atoms
     // are in the same residue in the same protein. Because of the delta
     // carbon to nitrogen bond of prolines, they need special handling
-    else if (m_residue == "PRO") {
+    else if (residue() == "PRO") {
         // Non-proline, N-terminal amino acids that are having proline
         // considered as a rotamer have an "extra" atom. Use the smallest
         // non-bonded exclusion value without question to ensure no energies
         // are calculated with that atom
-        if (other->m_name == "HT3") {return 2;}
+        if (other->name() == "HT3") {return 2;}
         // A subsequent portion of this function will calculate the values
         // from atoms off of the alpha carbon. Here, do the calculations for
         // atoms off of the nitrogen
-        else if (other->m_name == "N") {
-            if (m_name == "CD") {return 2;}
-            else if ((m_name == "CG") || 
-                    ((m_name == "HD1") || (m_name == "HD2"))) {return 3;}
+        else if (other->name() == "N") {
+            if (name() == "CD") {return 2;}
+            else if ((name() == "CG") || 
+                    ((name() == "HD1") || (name() == "HD2"))) {return 3;}
             // The beta carbon is a 3, going through the alpha carbon. That
             // gets picked up later.
-            else if ((m_name == "HG1") || (m_name == "HG2")) {return 4;}}
+            else if ((name() == "HG1") || (name() == "HG2")) {return 4;}}
         // Backbone Atoms bound to the nitrogen
-        else if ((((other->m_name == "CA") || (other->m_name == "HN")) ||
-                  ((other->m_name == "HN1") || (other->m_name == "HN2"))) ||
-                  ((other->m_name == "HT1") || (other->m_name == "HT2"))) {
-            if (m_name == "CD") {return 3;}
+        else if ((((other->name() == "CA") || (other->name() == "HN")) ||
+                  ((other->name() == "HN1") || (other->name() == "HN2"))) ||
+                  ((other->name() == "HT1") || (other->name() == "HT2"))) {
+            if (name() == "CD") {return 3;}
             // The gamma carbon with the alpha carbon is a 3 via the beta
             // carbon. Get that correct here
-            else if ((m_name == "CG") || (other->m_name == "CA")) {return 3;}
-            else if ((m_name == "CG") || 
-                    ((m_name == "HD1") || (m_name == "HD2"))) {return 4;}}
+            else if ((name() == "CG") || (other->name() == "CA")) {return 3;}
+            else if ((name() == "CG") || 
+                    ((name() == "HD1") || (name() == "HD2"))) {return 4;}}
         // Backbone Atoms bound to those atoms in this residue
-        else if ((other->m_name == "C") || 
-                ((other->m_name == "HA") || (other->m_name == "HA2"))) {
-            if (m_name == "CD") {return 4;}}}
+        else if ((other->name() == "C") || 
+                ((other->name() == "HA") || (other->name() == "HA2"))) {
+            if (name() == "CD") {return 4;}}}
     // Search through the possibilities for within the same residue via
     // alpha-carbon connections. This is also done for prolines, since they
     // still have the same alpha-carbon connections
@@ -114,25 +114,25 @@ int PROT::Atom::exclusions (const Atom * other) const {
                          "ND2", "SD"};
     // Check the Beta Carbon Atoms
     for(size_t i=0; i<2; ++i) {
-        if (m_name == beta[i]) {
+        if (name() == beta[i]) {
             for(size_t j=0; j<1; ++j) {
-                if (other->m_name == first[j]) {return 2;}}
+                if (other->name() == first[j]) {return 2;}}
             for(size_t j=0; j<4; ++j) {
-                if (other->m_name == second[j]) {return 3;}}
+                if (other->name() == second[j]) {return 3;}}
             for(size_t j=0; j<9; ++j) {
-                if (other->m_name == third[j]) {return 4;}}}}
+                if (other->name() == third[j]) {return 4;}}}}
     // Gamma position atoms
     for(size_t i=0; i<10; ++i) {
-        if (m_name == gamma[i]) {
+        if (name() == gamma[i]) {
             for(size_t j=0; j<1; ++j) {
-                if (other->m_name == first[j]) {return 3;}}
+                if (other->name() == first[j]) {return 3;}}
             for(size_t j=0; j<4; ++j) {
-                if (other->m_name == second[j]) {return 4;}}}}
+                if (other->name() == second[j]) {return 4;}}}}
     // Delta position atoms
     for(size_t i=0; i<17; ++i) {
-        if (m_name == delta[i]) {
+        if (name() == delta[i]) {
             for(size_t j=0; j<1; ++j) {
-                if (other->m_name == first[j]) {return 4;}}}}
+                if (other->name() == first[j]) {return 4;}}}}
     // In any other circumstance, return 0
     return 0;
 }
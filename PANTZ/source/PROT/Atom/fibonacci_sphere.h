@@ -33,24 +33,14 @@ vector<vector<float>> PROT::Atom::fibonacci_sphere (size_t N, float probe_radius
 
 // a function to get the radius of the atom (lennard jones sigma)
 float PROT::Atom::lj_sigma() const {
-    // Radii that Varun used
+    // Radii that Varun used for H, C, N, O and S, in the order of the radius
+    // classes that classify assigns
     // https://www.cgl.ucsf.edu/chimerax/docs/user/radii.html
-    if (m_element == "H") {
-        return 1;
-    }
-    else if (m_element == "C") {
-        return 1.7;
-    }
-    else if (m_element == "N") {
-        return 1.625;
-    }
-    else if (m_element == "O") {
-        return 1.5;
-    }
-    else if (m_element == "S") {
-        return 1.782;
+    static const float sigmas [] = {1, 1.7, 1.625, 1.5, 1.782};
+    if (m_radius != UnknownRadius) {
+        return sigmas[m_radius];
     } else {
-        string error = "Atom name not found in sigma map: " + m_element;
+        string error = "Atom name not found in sigma map: " + element();
         cout<<error<<endl;
         throw error;
     }
@@ -10,14 +10,18 @@
 
 // Assign default values to the Atom's attributes
 void PROT::Atom::initialize () {
-    // The atom's coordinates
+    // The atom's coordinates, which it keeps itself
+    m_coors = m_own;
     for(size_t i=0; i<AtomCoordinates; ++i) {m_coors[i] = 0.0;}
-    // String attributes
-    m_type = "ATOM";
-    m_name = "NONE";
-    m_residue = "NON";
-    m_element = "";
-    m_charge = "";
+    // Name attributes
+    m_hetatm = false;
+    m_name = Names::NoName;
+    m_residue = Names::NoResidue;
+    m_element = Names::Empty;
+    m_charge = Names::Empty;
+    // An unnamed Atom has no chemistry flags
+    m_flags = 0;
+    m_radius = UnknownRadius;
     // Integer attributes
     m_number = 1;
     m_residue_number = 1;
@@ -0,0 +1,174 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file is intended to be included by the Atom.h header file. It contains
+ * the method that reads an Atom directly from the text of a PDB file line. It
+ * accepts exactly the same lines as the standard constructor and gets the same
+ * information from them, but it reads each column in place and reports a bad
+ * line by returning false, so files can be read without creating a copy and an
+ * error for every line that is not an Atom. It also contains the method that
+ * reads an Atom from the values of a row of an mmCIF file's atom sites. */
+
+// Confirm that the Atom class has been declared and is actively being loaded
+#ifndef Atom_Loading_Status
+#error Atom methods must be included from the Atom.h header file
+#endif
+
+// A column of a PDB line, stripped of whitespace and in capital letters
+string AtomColumn (const char * line, const size_t start, const size_t length) {
+    size_t first = start, last = start + length;
+    while ((first < last) && (Text::is_whitespace(line[first]))) {++first;}
+    while ((last > first) && (Text::is_whitespace(line[last-1]))) {--last;}
+    string value (line + first, last - first);
+    for(size_t i=0; i<value.size(); ++i) {
+        if (Text::is_lower(value[i])) {value[i] -= 32;}}
+    return value;
+}
+
+// The value of a column that contains an integer
+bool AtomInteger (const string& value, long& n) {
+    if (!Text::is_integer(value)) {return false;}
+    size_t i = 0; bool negative = false;
+    if ((value[0] == '-') || (value[0] == '+')) {negative = (value[0] == '-'); ++i;}
+    n = 0;
+    for(; i<value.size(); ++i) {n = n*10 + (value[i] - '0');}
+    if (negative) {n = -n;}
+    return true;
+}
+
+// The value of a column that contains a number. A number that can't be
+// converted is 0, which is what reading it from a stream gives
+bool AtomNumber (const string& value, float& n) {
+    if (!Text::is_number(value)) {return false;}
+    char * end;
+    n = strtof(value.c_str(), &end);
+    if ((end == value.c_str()) || (*end != '\0')) {n = 0.0;}
+    return true;
+}
+
+// Read the Atom from a line of text that is not necessarily ended by a null
+// character
+bool PROT::Atom::read (const char * text, const size_t count) {
+    // Strip the whitespace from the line
+    size_t first = 0, last = count;
+    while ((first < last) && (Text::is_whitespace(text[first]))) {++first;}
+    while ((last > first) && (Text::is_whitespace(text[last-1]))) {--last;}
+    const char * line = text + first;
+    const size_t size = last - first;
+    // There must be at least 66 columns
+    if (size < 66) {return false;}
+    // Determine the Atom's type
+    string value (line, 6);
+    for(size_t i=0; i<6; ++i) {
+        if (Text::is_lower(value[i])) {value[i] -= 32;}}
+    if (value == "ATOM  ") {m_hetatm = false;}
+    else if (value == "HETATM") {m_hetatm = true;}
+    else {return false;}
+    // Get the Atom's number
+    if ((!AtomInteger(AtomColumn(line, 6, 5), m_number)) ||
+        (!CHECK::is_atom_number(m_number))) {return false;}
+    // Get the Atom's name
+    value = AtomColumn(line, 12, 4);
+    if (!CHECK::is_atom_name(value)) {return false;}
+    m_name = Names::intern(value);
+    // Get the alternative location information
+    m_alt = Text::is_lower(line[16]) ? line[16] - 32 : line[16];
+    if (!CHECK::is_alt_location(m_alt)) {return false;}
+    // Get the residue's name
+    value = AtomColumn(line, 17, 3);
+    if (!CHECK::is_residue_name(value)) {return false;}
+    m_residue = Names::intern(value);
+    // Get the Protein's name
+    m_protein = Text::is_lower(line[21]) ? line[21] - 32 : line[21];
+    if (!CHECK::is_protein_name(m_protein)) {return false;}
+    // Get the Residue's number
+    if ((!AtomInteger(AtomColumn(line, 22, 4), m_residue_number)) ||
+        (!CHECK::is_residue_number(m_residue_number))) {return false;}
+    // Get the Residue's insertion code
+    m_insertion = Text::is_lower(line[26]) ? line[26] - 32 : line[26];
+    if (!CHECK::is_insertion_code(m_insertion)) {return false;}
+    // Get the Atom's coordinates
+    for(size_t i=0; i<3; ++i) {
+        if ((!AtomNumber(AtomColumn(line, 30 + (i*8), 8), m_coors[i])) ||
+            (!CHECK::is_atom_coordinate(m_coors[i]))) {return false;}}
+    // Get the Atom's occupancy and temperature
+    if ((!AtomNumber(AtomColumn(line, 54, 6), m_occupancy)) ||
+        (!CHECK::is_occupancy(m_occupancy))) {return false;}
+    if ((!AtomNumber(AtomColumn(line, 60, 6), m_temperature)) ||
+        (!CHECK::is_temperature(m_temperature))) {return false;}
+    // The element and charge information may not be present
+    if (size >= 78) {
+        value = AtomColumn(line, 76, 2);
+        if (!CHECK::is_element(value)) {return false;}
+        m_element = Names::intern(value);
+        if (size >= 80) {
+            value = AtomColumn(line, 78, 2);
+            if (!CHECK::is_charge(value)) {return false;}
+            m_charge = Names::intern(value);}}
+    // Work out the chemistry flags from the names
+    classify();
+    return true;
+}
+
+// Read the Atom from the values of an mmCIF _atom_site row
+bool PROT::Atom::read (const vector<string>& site) {
+    // The values are compared in capital letters, like the text of PDB lines
+    string value = site[SiteGroup]; Text::upper(value);
+    if (value == "ATOM") {m_hetatm = false;}
+    else if (value == "HETATM") {m_hetatm = true;}
+    else {return false;}
+    // Get the Atom's number, which may be larger than fits in a PDB file
+    if ((!AtomInteger(site[SiteNumber], m_number)) || (m_number < 1)) {
+        return false;}
+    // Get the Atom's name
+    value = site[SiteName]; Text::upper(value);
+    if (!CHECK::is_atom_name(value)) {return false;}
+    m_name = Names::intern(value);
+    // Get the alternative location information
+    value = site[SiteAlt]; Text::upper(value);
+    if (value.size() > 1) {return false;}
+    m_alt = (value.size() == 0) ? ' ' : value[0];
+    if (!CHECK::is_alt_location(m_alt)) {return false;}
+    // Get the residue's name
+    value = site[SiteResidue]; Text::upper(value);
+    if (!CHECK::is_residue_name(value)) {return false;}
+    m_residue = Names::intern(value);
+    // Get the Protein's name
+    value = site[SiteProtein]; Text::upper(value);
+    if (value.size() != 1) {return false;}
+    m_protein = value[0];
+    if (!CHECK::is_protein_name(m_protein)) {return false;}
+    // Get the Residue's number and insertion code
+    if (!AtomInteger(site[SiteResidueNumber], m_residue_number)) {return false;}
+    value = site[SiteInsertion]; Text::upper(value);
+    if (value.size() > 1) {return false;}
+    m_insertion = (value.size() == 0) ? ' ' : value[0];
+    if (!CHECK::is_insertion_code(m_insertion)) {return false;}
+    // Get the Atom's coordinates
+    for(size_t i=0; i<3; ++i) {
+        if ((!AtomNumber(site[SiteX + i], m_coors[i])) ||
+            (!std::isfinite(m_coors[i]))) {return false;}}
+    // The occupancy and temperature may be missing
+    if ((site[SiteOccupancy].size() > 0) &&
+        ((!AtomNumber(site[SiteOccupancy], m_occupancy)) ||
+         (!CHECK::is_occupancy(m_occupancy)))) {return false;}
+    if ((site[SiteTemperature].size() > 0) &&
+        ((!AtomNumber(site[SiteTemperature], m_temperature)) ||
+         (!CHECK::is_temperature(m_temperature)))) {return false;}
+    // Get the element, if it is there
+    value = site[SiteElement]; Text::upper(value);
+    if (!CHECK::is_element(value)) {return false;}
+    m_element = Names::intern(value);
+    // mmCIF files give the charge as an integer, which is written with its
+    // sign first the way the PDB charge check expects
+    long charge = 0;
+    if ((site[SiteCharge].size() > 0) &&
+        ((!AtomInteger(site[SiteCharge], charge)) || (charge < -9) ||
+         (charge > 9))) {return false;}
+    if (charge != 0) {
+        value = (charge < 0) ? "-" : "+";
+        value += (char) ('0' + ((charge < 0) ? -charge : charge));
+        m_charge = Names::intern(value);}
+    // Work out the chemistry flags from the names
+    classify();
+    return true;
+}
@@ -10,18 +10,7 @@
 
 // Rotate the Atom's position without error checking the matrix
 void PROT::Atom::private_rotate (const Matrix * matrix) {
-    // Create an array of the new coordinates
-    coor newCoors [AtomCoordinates];
-    // Calculate the new coordinates
-    for(size_t i=0; i<AtomCoordinates; ++i) {
-        // Set the new coordinate value to 0
-        newCoors[i] = 0;
-        // Loop through the current coordinates
-        for(size_t j=0; j<AtomCoordinates; ++j) {
-            // Add the appropriate product value to the new coordinate
-            newCoors[i] += (matrix->operator()(i, j) * m_coors[j]);}}
-    // Store the new coordinates as the Atom's coordinates
-    for(size_t i=0; i<AtomCoordinates; ++i) {m_coors[i] = newCoors[i];}
+    matrix->rotate_coordinates(m_coors);
 }
 
 // Rotate an Atom, but only after checking that the provide matrix is
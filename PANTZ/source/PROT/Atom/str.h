@@ -16,20 +16,21 @@ string PROT::Atom::str () const {
     output.reserve(AtomStringLength);
     // Include the Atom's attributes with proper formatting and spacing
     // The Atom's type
-    Text::ljust_insert (output, m_type, 6, ' ');
+    Text::ljust_insert (output, type(), 6, ' ');
     // The Atom's number
     stringstream c1; c1 << m_number;
     Text::rjust_insert(output, c1.str(), 5, ' ');
     // A blank space
     output.push_back(' ');
     // The Atom's name
-    if (m_name.size() < 4) {
-        output.push_back(' '); Text::ljust_insert(output, m_name, 3, ' ');}
-    else {Text::ljust_insert(output, m_name, 4, ' ');}
+    const string& atom_name = name();
+    if (atom_name.size() < 4) {
+        output.push_back(' '); Text::ljust_insert(output, atom_name, 3, ' ');}
+    else {Text::ljust_insert(output, atom_name, 4, ' ');}
     // The alternate location character
     output.push_back(m_alt);
     // The Residue's name
-    Text::ljust_insert(output, m_residue, 3, ' ');
+    Text::ljust_insert(output, residue(), 3, ' ');
     // A blank space
     output.push_back (' ');
     // The protein's name
@@ -53,9 +54,9 @@ string PROT::Atom::str () const {
     stringstream c5; c5 << fixed << setprecision(2) << m_temperature;
     Text::rjust_insert(output, c5.str(), 6, ' ');
     // The Atom's element
-    Text::rjust_insert(output, m_element, 12, ' ');
+    Text::rjust_insert(output, element(), 12, ' ');
     // The Atom's charge
-    Text::rjust_insert(output, m_charge, 2, ' ');
+    Text::rjust_insert(output, charge(), 2, ' ');
     // Add an end line character to terminate the string
     output.push_back('\n');
     return output;
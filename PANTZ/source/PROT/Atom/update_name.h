@@ -10,40 +10,45 @@
 
 // Update an Atom's name for use in Rosetta
 void PROT::Atom::update_name_for_Rosetta (bool lastResidue = false) {
+    const string& atom_name = name();
     // Because hydrogens are never output to Rosetta, their names don't have to
     // be updated for it. Only update heavy atoms
-    if ((m_residue == "ILE") && (m_name == "CD")) {m_name = "CD1";}
-    else if ((lastResidue) && (m_name == "OT1")) {m_name = "O";}
-    else if ((lastResidue) && (m_name == "OT2")) {m_name = "OXT";}
+    if ((residue() == "ILE") && (atom_name == "CD")) {set_name(Names::intern("CD1"));}
+    else if ((lastResidue) && (atom_name == "OT1")) {set_name(Names::O);}
+    else if ((lastResidue) && (atom_name == "OT2")) {set_name(Names::intern("OXT"));}
 }
 
 // Update an Atom's name after Rosetta. This is much more complicated because
 // Rosetta uses a different Hydrogen naming convention than CHARMM or the
 // Rotamer library
 void PROT::Atom::update_name_after_Rosetta (bool lastResidue = false) {
+    // The name is edited as text and interned again at the end
+    string atom_name = name();
     // Update the delta carbon of isoleucine
-    if ((m_residue == "ILE") && (m_name == "CD1")) {m_name = "CD";}
+    if ((residue() == "ILE") && (atom_name == "CD1")) {atom_name = "CD";}
     // Terminal oxygens
-    else if ((lastResidue) && (m_name == "O")) {m_name = "OT1";}
-    else if ((lastResidue) && (m_name == "OXT")) {m_name = "OT2";}
+    else if ((lastResidue) && (atom_name == "O")) {atom_name = "OT1";}
+    else if ((lastResidue) && (atom_name == "OXT")) {atom_name = "OT2";}
     // Hydrogens are more complicated. While the general rule is to move the
     // leading digit to the end of the name, there are other name schemes, too
     else if (is_hydrogen()) {
         // N-terminal hydrogens
-        if ((m_name == "1H") || ((m_name == "2H") || (m_name == "3H"))) {
-            char digit = m_name[0];
-            m_name = "HT";
-            m_name += digit;}
+        if ((atom_name == "1H") || ((atom_name == "2H") || (atom_name == "3H"))) {
+            char digit = atom_name[0];
+            atom_name = "HT";
+            atom_name += digit;}
         // Hydrogens on N
-        else if (m_name == "H") {m_name = "HN";}
+        else if (atom_name == "H") {atom_name = "HN";}
         // If the name starts with a digit, move it to the end of the name
-        else if (Text::is_digit(m_name[0])) {
+        else if (Text::is_digit(atom_name[0])) {
             // Get the digit
-            char digit = m_name[0];
+            char digit = atom_name[0];
             // The number of characters to include in the moved piece
-            size_t n = m_name.size() - 1;
+            size_t n = atom_name.size() - 1;
             // Get the last n characters of the atom's name
-            m_name = m_name.substr(1, n);
+            atom_name = atom_name.substr(1, n);
             // Add the digit to the end of the name
-            m_name += digit;}}
+            atom_name += digit;}}
+    // Only look the name up again if it changed
+    if (atom_name != name()) {set_name(Names::intern(atom_name));}
 }
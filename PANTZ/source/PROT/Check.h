@@ -16,10 +16,17 @@
 // This file is intended to be included in the Proteins.h header file directly
 // during compilation. Do not include any other header files here.
 
-// Implement the methods of the CHECK namespace
+// Implement the methods of the CHECK namespace. Each check has a version that
+// returns whether or not the information is acceptable, which is used when
+// bad information should just be skipped, and a version that throws an error
+// explaining the problem
 // Atom numbers must be between 1 and 99999
+bool CHECK::is_atom_number (const long n) {
+    return ((n >= 1) && (n <= 99999));
+}
+
 void CHECK::atom_number (const long n) {
-    if ((n < 1) || (n > 99999)) {
+    if (!is_atom_number(n)) {
         stringstream c; c << n;
         string error = "PDB atom numbers must be between 1 and 99,999.\n"
                      + c.str() + " is not acceptable.\n";
@@ -28,23 +35,33 @@ void CHECK::atom_number (const long n) {
 
 // Atom names must contain 1-4 characters, each of which is a capital letter
 // or digit
+bool CHECK::is_atom_name (const string& name) {
+    if ((name.size() < 1) || (name.size() > 4)) {return false;}
+    for (size_t i=0; i<name.size(); ++i) {
+        if ((!Text::is_digit(name[i])) && (!Text::is_upper(name[i]))) {
+            return false;}}
+    return true;
+}
+
 void CHECK::atom_name (const string& name) {
+    if (is_atom_name(name)) {return;}
     if ((name.size() < 1) || (name.size() > 4)) {
         string error = "PDB atom names must contain between 1 and 4 "
                        "characters.\n" + name + " is not acceptable.\n";
         throw PANTZ_error (error);}
-    for (size_t i=0; i<name.size(); ++i) {
-        // Allow the digits 0-9 and capital letters
-        if ((!Text::is_digit(name[i])) && (!Text::is_upper(name[i]))) {
-            string error = "This string contains unacceptable characters for an "
-                           "Atom name: " + name + "\n";
-            throw PANTZ_error (error);}}
+    string error = "This string contains unacceptable characters for an "
+                   "Atom name: " + name + "\n";
+    throw PANTZ_error (error);
 }
 
 // The alternative location information for a residue may be a blank space or
 // a capital letter
+bool CHECK::is_alt_location (const char L) {
+    return ((L == 32) || (Text::is_upper(L)));
+}
+
 void CHECK::alt_location (const char L) {
-    if ((L != 32) && (!Text::is_upper(L))) {
+    if (!is_alt_location(L)) {
         string error = "PDB atom alternative location values may only be "
                        "blank spaces or capital letters.\n'";
         error += L;
@@ -56,23 +73,33 @@ void CHECK::alt_location (const char L) {
 // However, other types of residues do not necessarily have to follow that
 // requirement. For example, 1BNA is a file of DNA and the nucleic acid names
 // are DA, DT, DC, and DG.
+bool CHECK::is_residue_name (const string& name) {
+    if ((name.size() < 1) || (name.size() > 3)) {return false;}
+    for(size_t i=0; i<name.size(); ++i) {
+        if ((!Text::is_digit(name[i])) && (!Text::is_upper(name[i]))) {
+            return false;}}
+    return true;
+}
+
 void CHECK::residue_name (const string& name) {
+    if (is_residue_name(name)) {return;}
     // Validate that there is something in the name and it is not more than 3
     // characters
     if ((name.size() < 1) || (name.size() > 3)){
         string error = name + " is not an acceptable PDB residue name.\n";
         throw PANTZ_error (error);}
-    // Check thsoe characters
-    for(size_t i=0; i<name.size(); ++i) {
-        if ((!Text::is_digit(name[i])) && (!Text::is_upper(name[i]))) {
-            string error = "PDB residue names may only contain digits and "
-                           "capital letters.\n"+name+" is not acceptable.\n";
-            throw PANTZ_error (error);}}
+    string error = "PDB residue names may only contain digits and "
+                   "capital letters.\n"+name+" is not acceptable.\n";
+    throw PANTZ_error (error);
 }
 
 // Protein names may be blank, a digit, or a capital letter
+bool CHECK::is_protein_name (const char L) {
+    return ((L == 32) || (Text::is_upper(L)) || (Text::is_digit(L)));
+}
+
 void CHECK::protein_name (const char L) {
-    if (((L != 32) && (!Text::is_upper(L))) && (!Text::is_digit(L))) {
+    if (!is_protein_name(L)) {
         string error = "PDB protein names may only be blank spaces, digits, "
                        "or capital letters.\n'";
         error += L;
@@ -81,8 +108,12 @@ void CHECK::protein_name (const char L) {
 }
 
 // Residue numbers must be between -999 and 9999
+bool CHECK::is_residue_number (const long n) {
+    return ((n >= -999) && (n <= 9999));
+}
+
 void CHECK::residue_number (const long n) {
-    if ((n < -999) || (n > 9999)) {
+    if (!is_residue_number(n)) {
         stringstream c; c << n;
         string error = "PDB residue numbers must be betweeen -999 and 9999.\n"
                      + c.str() + " is not acceptable.\n";
@@ -90,8 +121,12 @@ void CHECK::residue_number (const long n) {
 }
 
 // Residue insertion codes may be a blank space or a capital letter
+bool CHECK::is_insertion_code (const char L) {
+    return ((L == 32) || (Text::is_upper(L)));
+}
+
 void CHECK::insertion_code (const char L) {
-    if ((L != 32) && (!Text::is_upper(L))) {
+    if (!is_insertion_code(L)) {
         string error = "PDB residue insertion codes may only be blank spaces "
                        "or capital letters.\n'";
         error += L;
@@ -100,8 +135,12 @@ void CHECK::insertion_code (const char L) {
 }
 
 // Atom coordinates must be between -999.999 and 999.999
+bool CHECK::is_atom_coordinate (const PROT::coor n) {
+    return !((n <= -999.9995) || (n >= 999.9995));
+}
+
 void CHECK::atom_coordinate (const PROT::coor n) {
-    if ((n <= -999.9995) || (n >= 999.9995)) {
+    if (!is_atom_coordinate(n)) {
         stringstream c; c << fixed << setprecision(3) << n;
         string error = "PDB atom coordinates must be between -999.999 and "
                        "999.999.\n" + c.str() + " is not acceptable.\n";
@@ -109,8 +148,12 @@ void CHECK::atom_coordinate (const PROT::coor n) {
 }
 
 // Atom occupancies must be between 0.0 and 1.0
+bool CHECK::is_occupancy (const float n) {
+    return !((n < 0.0) || (n > 1.0));
+}
+
 void CHECK::occupancy (const float n) {
-    if ((n < 0.0) || (n > 1.0)) {
+    if (!is_occupancy(n)) {
         stringstream c; c << fixed << setprecision(2) << n;
         string error = "PDB atom occupancies must be between 0.0 and 1.0.\n"
                      + c.str() + " is not acceptable.\n";
@@ -118,8 +161,12 @@ void CHECK::occupancy (const float n) {
 }
 
 // An Atom's temperature must be between 0 and 1000
+bool CHECK::is_temperature (const float n) {
+    return !((n < 0.0) || (n > 1000.0));
+}
+
 void CHECK::temperature (const float n) {
-    if ((n < 0.0) || (n > 1000.0)) {
+    if (!is_temperature(n)) {
         stringstream c; c << fixed << setprecision(2) << n;
         string error = "PDB atom temperatures must be between 0 and 1000.\n"
                      + c.str() + " is not acceptable.\n";
@@ -127,26 +174,35 @@ void CHECK::temperature (const float n) {
 }
 
 // The Atom's element information may be 0-2 capital letters
+bool CHECK::is_element (const string& input) {
+    if (input.size() > 2) {return false;}
+    for(size_t i=0; i<input.size(); ++i) {
+        if (!Text::is_upper(input[i])) {return false;}}
+    return true;
+}
+
 void CHECK::element (const string& input) {
-    // Allow blank strings
-    if (input.size() == 0) {return;}
+    if (is_element(input)) {return;}
     // If there are too many characters, throw an error
-    else if (input.size() > 2) {
+    if (input.size() > 2) {
         string error = "PDB atom elements may be no more than 2 characters.\n"
                      + input + " is not acceptable.\n";
         throw PANTZ_error (error);}
-    // Check the characters are capital letters
-    for(size_t i=0; i<input.size(); ++i) {
-        if (!Text::is_upper(input[i])) {
-            string error = "PDB atom elements may only contain capital "
-                           "letters.\n" + input + " is not acceptable.\n";
-            throw PANTZ_error (error);}}
+    string error = "PDB atom elements may only contain capital "
+                   "letters.\n" + input + " is not acceptable.\n";
+    throw PANTZ_error (error);
 }
 
 // The Atom's charge may be blank or 2 characters. If it is 2 characters, the
 // first must be + or - and the second a digit
+bool CHECK::is_charge (const string& input) {
+    if (input.size() == 0) {return true;}
+    return ((input.size() == 2) && ((input[0] == '-') || (input[0] == '+')) &&
+            (Text::is_digit(input[1])));
+}
+
 void CHECK::charge (const string& input) {
-    if (input.size() == 0) {return;}
+    if (is_charge(input)) {return;}
     else if (input.size() != 2) {
         string error = "PDB atom charge values must be exactly 2 "
                        "characters long.\n" + input + " is not acceptable.\n";
@@ -155,19 +211,14 @@ void CHECK::charge (const string& input) {
         string error = "PDB atom charge values must start with either '+' or "
                        "'-'.\n" + input + " is not acceptable.\n";
         throw PANTZ_error (error);}
-    else if (!Text::is_digit(input[1])) {
-        string error = "PDB atom charge values must be integer numbers.\n"
-                     + input + " is not acceptable.\n";
-        throw PANTZ_error (error);}
+    string error = "PDB atom charge values must be integer numbers.\n"
+                 + input + " is not acceptable.\n";
+    throw PANTZ_error (error);
 }
 
 // A function that determines whether or not a Residue is an amino acid
 bool CHECK::is_amino_acid (const string& text) {
-    // Loop through the 3 amino acid codes
-    for(size_t i=0; i<PROT::AA3.size(); ++i) {
-        if (text == PROT::AA3[i]) {return true;}}
-    // Otherwise, return false
-    return false;
+    return (PROT::amino_acid(text) != PROT::NotAminoAcid);
 }
 
 // Determine whether or not a string represents a backbone atom
@@ -0,0 +1,215 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file contains the chemistry of the amino acids that the Residue class's
+ * methods use: the atoms that donate and accept hydrogen bonds, the polar and
+ * charged atoms, the atoms that define each chi angle and the default backbone
+ * dihedral angles. Each table is a constant array with one entry per amino
+ * acid, in the order of the AminoAcid enum, so looking something up is an
+ * array index and the tables can be read by any number of threads at once.
+ * The atom names are CHARMM names (from top_all36_prot.rtf). */
+
+// Use a header guard to make sure this file is only included in a compiled
+// program a single time
+#ifndef Proteins_Chemistry_Guard
+#define Proteins_Chemistry_Guard 1
+
+// Make sure this file is being included from the Proteins.h header file
+#ifndef Proteins_Loading_Status
+#error Chemistry.h must be included by Proteins.h
+#endif
+
+// The key of a 3 letter name, which lets a switch statement find it
+constexpr uint32_t amino_acid_key (const char a, const char b, const char c) {
+    return (uint32_t(uint8_t(a)) << 16) | (uint32_t(uint8_t(b)) << 8) | uint32_t(uint8_t(c));
+}
+
+// The amino acid with a 3 letter name
+PROT::AminoAcid PROT::amino_acid (const string& name) {
+    if (name.size() != 3) {return NotAminoAcid;}
+    switch (amino_acid_key(name[0], name[1], name[2])) {
+        case amino_acid_key('A', 'L', 'A'): return ALA;
+        case amino_acid_key('C', 'Y', 'S'): return CYS;
+        case amino_acid_key('A', 'S', 'P'): return ASP;
+        case amino_acid_key('G', 'L', 'U'): return GLU;
+        case amino_acid_key('P', 'H', 'E'): return PHE;
+        case amino_acid_key('G', 'L', 'Y'): return GLY;
+        case amino_acid_key('H', 'I', 'S'): return HIS;
+        case amino_acid_key('I', 'L', 'E'): return ILE;
+        case amino_acid_key('L', 'Y', 'S'): return LYS;
+        case amino_acid_key('L', 'E', 'U'): return LEU;
+        case amino_acid_key('M', 'E', 'T'): return MET;
+        case amino_acid_key('A', 'S', 'N'): return ASN;
+        case amino_acid_key('P', 'R', 'O'): return PRO;
+        case amino_acid_key('G', 'L', 'N'): return GLN;
+        case amino_acid_key('A', 'R', 'G'): return ARG;
+        case amino_acid_key('S', 'E', 'R'): return SER;
+        case amino_acid_key('T', 'H', 'R'): return THR;
+        case amino_acid_key('V', 'A', 'L'): return VAL;
+        case amino_acid_key('T', 'R', 'P'): return TRP;
+        case amino_acid_key('T', 'Y', 'R'): return TYR;
+        case amino_acid_key('H', 'S', 'D'): return HSD;
+        case amino_acid_key('H', 'S', 'E'): return HSE;
+        default: return NotAminoAcid;}
+}
+
+// The standard amino acid with a 1 letter code
+PROT::AminoAcid PROT::amino_acid (const char code) {
+    for(size_t i=0; i<StandardAminoAcids; ++i) {
+        if (AminoAcidCodes[i] == code) {return AminoAcid(i);}}
+    return NotAminoAcid;
+}
+
+// Define the tables in the PROT namespace
+namespace PROT {
+
+    // A list of atom names
+    struct AtomNames {
+        size_t count;
+        const char * names [17];
+    };
+
+    // A hydrogen bond group. For a donor, the hydrogen and the atom that
+    // donates it. For an acceptor, the accepting atom and its antecedent, or
+    // the two atoms whose midpoint is its antecedent. An atom belongs to a
+    // group when its name contains the group's atom name
+    struct HBondGroup {
+        const char * atom;
+        const char * antecedent;
+        const char * second_antecedent;
+    };
+    struct HBondGroups {
+        size_t count;
+        HBondGroup groups [6];
+    };
+
+    // The hydrogen bond donors of each standard amino acid
+    const HBondGroups HBondDonors [StandardAminoAcids] = {
+        {1, {{"HN", "N", 0}}},
+        {2, {{"HN", "N", 0}, {"HG1", "SG", 0}}},
+        {1, {{"HN", "N", 0}}},
+        {1, {{"HN", "N", 0}}},
+        {1, {{"HN", "N", 0}}},
+        {1, {{"HN", "N", 0}}},
+        {3, {{"HN", "N", 0}, {"HD1", "ND1", 0}, {"HE2", "NE2", 0}}},
+        {1, {{"HN", "N", 0}}},
+        {4, {{"HN", "N", 0}, {"HZ1", "NZ", 0}, {"HZ2", "NZ", 0}, {"HZ3", "NZ", 0}}},
+        {1, {{"HN", "N", 0}}},
+        {1, {{"HN", "N", 0}}},
+        {3, {{"HN", "N", 0}, {"HD21", "ND2", 0}, {"HD22", "ND2", 0}}},
+        {0, {}},
+        {3, {{"HN", "N", 0}, {"HE21", "NE2", 0}, {"HE22", "NE2", 0}}},
+        {6, {{"HN", "N", 0}, {"HE", "NE", 0}, {"HH11", "NH1", 0}, {"HH12", "NH1", 0}, {"HH21", "NH2", 0}, {"HH22", "NH2", 0}}},
+        {2, {{"HN", "N", 0}, {"HG1", "OG", 0}}},
+        {2, {{"HN", "N", 0}, {"HG1", "OG1", 0}}},
+        {1, {{"HN", "N", 0}}},
+        {2, {{"HN", "N", 0}, {"HE1", "NE1", 0}}},
+        {2, {{"HN", "N", 0}, {"HH", "OH", 0}}}};
+
+    // The hydrogen bond acceptors of each standard amino acid
+    const HBondGroups HBondAcceptors [StandardAminoAcids] = {
+        {1, {{"O", "C", 0}}},
+        {1, {{"O", "C", 0}}},
+        {3, {{"OD1", "CG", 0}, {"OD2", "CG", 0}, {"O", "C", 0}}},
+        {3, {{"OE1", "CD", 0}, {"OE2", "CD", 0}, {"O", "C", 0}}},
+        {1, {{"O", "C", 0}}},
+        {1, {{"O", "C", 0}}},
+        {3, {{"NE2", "CD2", "CE1"}, {"O", "C", 0}, {"ND1", "CG", "CE1"}}},
+        {1, {{"O", "C", 0}}},
+        {1, {{"O", "C", 0}}},
+        {1, {{"O", "C", 0}}},
+        {1, {{"O", "C", 0}}},
+        {2, {{"OD1", "CG", 0}, {"O", "C", 0}}},
+        {1, {{"O", "C", 0}}},
+        {2, {{"OE1", "CD", 0}, {"O", "C", 0}}},
+        {1, {{"O", "C", 0}}},
+        {2, {{"OG", "CB", 0}, {"O", "C", 0}}},
+        {2, {{"OG1", "CB", 0}, {"O", "C", 0}}},
+        {1, {{"O", "C", 0}}},
+        {1, {{"O", "C", 0}}},
+        {2, {{"OH", "CZ", 0}, {"O", "C", 0}}}};
+
+    // The polar atoms of each amino acid name, as the hydrophobic interaction
+    // method identifies them. HSE has none
+    const AtomNames PolarAtoms [AminoAcidNames] = {
+        {9, {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "N"}},
+        {9, {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "N"}},
+        {11, {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "OD1", "OD2", "N"}},
+        {11, {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "OE1", "OE2", "N"}},
+        {9, {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "N"}},
+        {9, {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "N"}},
+        {13, {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "ND1", "HE2", "NE2", "HD1", "N"}},
+        {9, {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "N"}},
+        {13, {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "HZ1", "HZ2", "HZ3", "N", "NZ"}},
+        {9, {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "N"}},
+        {9, {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "N"}},
+        {13, {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "OD1", "HD21", "HD22", "N", "ND2"}},
+        {8, {"O", "C", "OT1", "OT2", "HT1", "HT2", "HT3", "N"}},
+        {13, {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "OE1", "HE21", "HE22", "N", "NE2"}},
+        {17, {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "HE", "HH11", "HH12", "HH21", "HH22", "N", "NH1", "NH2", "NE"}},
+        {11, {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "OG", "HG", "N"}},
+        {11, {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "OG1", "HG1", "N"}},
+        {9, {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "N"}},
+        {11, {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "HE1", "N", "NE1"}},
+        {11, {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "OH", "HH", "N"}},
+        {13, {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "ND1", "HE2", "NE2", "HD1", "N"}},
+        {0, {}}};
+
+    // The atoms of the charged groups of each standard amino acid, and the
+    // terminal atoms, which are charged in any amino acid
+    const AtomNames ChargedAtoms [StandardAminoAcids] = {
+        {0, {}}, {0, {}},
+        {3, {"CG", "OD1", "OD2"}},
+        {3, {"CD", "OE1", "OE2"}},
+        {0, {}}, {0, {}}, {0, {}}, {0, {}},
+        {4, {"NZ", "HZ1", "HZ2", "HZ3"}},
+        {0, {}}, {0, {}}, {0, {}}, {0, {}}, {0, {}},
+        {9, {"NE", "HE", "CZ", "NH1", "HH11", "HH12", "NH2", "HH21", "HH22"}},
+        {0, {}}, {0, {}}, {0, {}}, {0, {}}, {0, {}}};
+    const AtomNames TerminalAtoms = {6, {"HT1", "HT2", "HT3", "OT1", "OT2", "OXT"}};
+
+    // The four atoms that define each chi angle of each standard amino acid
+    struct ChiAngles {
+        size_t count;
+        const char * atoms [4][4];
+    };
+    const ChiAngles ChiDefinitions [StandardAminoAcids] = {
+        {0, {}},
+        {1, {{"N", "CA", "CB", "SG"}}},
+        {2, {{"N", "CA", "CB", "CG"}, {"CA", "CB", "CG", "OD1"}}},
+        {3, {{"N", "CA", "CB", "CG"}, {"CA", "CB", "CG", "CD"}, {"CB", "CG", "CD", "OE1"}}},
+        {2, {{"N", "CA", "CB", "CG"}, {"CA", "CB", "CG", "CD1"}}},
+        {0, {}},
+        {2, {{"N", "CA", "CB", "CG"}, {"CA", "CB", "CG", "ND1"}}},
+        {2, {{"N", "CA", "CB", "CG1"}, {"CA", "CB", "CG1", "CD"}}},
+        {4, {{"N", "CA", "CB", "CG"}, {"CA", "CB", "CG", "CD"}, {"CB", "CG", "CD", "CE"}, {"CG", "CD", "CE", "NZ"}}},
+        {2, {{"N", "CA", "CB", "CG"}, {"CA", "CB", "CG", "CD1"}}},
+        {3, {{"N", "CA", "CB", "CG"}, {"CA", "CB", "CG", "SD"}, {"CB", "CG", "SD", "CE"}}},
+        {2, {{"N", "CA", "CB", "CG"}, {"CA", "CB", "CG", "OD1"}}},
+        {3, {{"N", "CA", "CB", "CG"}, {"CA", "CB", "CG", "CD"}, {"CB", "CG", "CD", "HD2"}}},
+        {3, {{"N", "CA", "CB", "CG"}, {"CA", "CB", "CG", "CD"}, {"CB", "CG", "CD", "OE1"}}},
+        {4, {{"N", "CA", "CB", "CG"}, {"CA", "CB", "CG", "CD"}, {"CB", "CG", "CD", "NE"}, {"CG", "CD", "NE", "CZ"}}},
+        {1, {{"N", "CA", "CB", "OG"}}},
+        {1, {{"N", "CA", "CB", "OG1"}}},
+        {1, {{"N", "CA", "CB", "CG1"}}},
+        {2, {{"N", "CA", "CB", "CG"}, {"CA", "CB", "CG", "CD1"}}},
+        {2, {{"N", "CA", "CB", "CG"}, {"CA", "CB", "CG", "CD1"}}}};
+
+    // The average phi and psi angles of each standard amino acid, from 10000
+    // residues of 1000 random pdb files
+    const float DefaultDihedrals [StandardAminoAcids][2] = {
+        {-80, 30}, {-90, 60}, {-80, 30}, {-80, 20}, {-90, 50},
+        {-80, 30}, {-90, 40}, {-90, 50}, {-80, 30}, {-80, 30},
+        {-80, 30}, {-70, 30}, {-70, 70}, {-80, 30}, {-80, 30},
+        {-90, 50}, {-90, 60}, {-90, 60}, {-90, 40}, {-90, 50}};
+
+    // Whether or not a list contains a name
+    inline bool listed (const AtomNames& list, const string& name) {
+        for(size_t i=0; i<list.count; ++i) {
+            if (name == list.names[i]) {return true;}}
+        return false;}
+
+    // End the namespace
+}
+
+// End the header guard from the start of the file
+#endif
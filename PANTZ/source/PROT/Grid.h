@@ -0,0 +1,84 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file contains the declaration of the Grid class. It divides space into
+ * cubic cells and stores the items in each cell one after another in a single
+ * array, with an array of offsets to where each cell's items start. Finding the
+ * items within a fixed distance of a point only needs the cells that the
+ * distance reaches, so this is faster than a KDtree for the short cutoffs used
+ * with protein atoms and it is much cheaper to build. Like the KDtree, the
+ * items must have x(), y(), z() and distance() methods. The file also includes
+ * the header files where the methods of the class are implemented. */
+
+// Use a header guard to make sure this file is only included in a compiled
+// program a single time
+#ifndef Proteins_Grid_Guard
+#define Proteins_Grid_Guard 1
+
+// Make sure this file is being included from the Proteins.h header file
+#ifndef Proteins_Loading_Status
+#error Grid.h must be included by Proteins.h
+#endif
+
+// Define the Grid class
+template <class T>
+class PROT::Grid {
+    private:
+        // the items, grouped by cell
+        vector<T*> m_items;
+        // the place of each item in the vector the grid was made from
+        vector<size_t> m_index;
+        // the coordinates of each item, 3 per item in the same order
+        vector<coor> m_points;
+        // the items of cell i are m_items[m_starts[i]] up to (but not
+        // including) m_items[m_starts[i+1]]
+        vector<size_t> m_starts;
+        // the corner of the grid with the smallest coordinates
+        double m_origin [AtomCoordinates];
+        // the length of a side of a cell
+        double m_side;
+        // the number of cells in each dimension
+        size_t m_cells [AtomCoordinates];
+        // the cell that a coordinate is in, in one dimension. Coordinates
+        // outside of the grid are put in the cell on its edge
+        size_t cell (const double, const size_t) const;
+        // call a function for every item in the cells within a distance of a
+        // point, stopping early if the function returns false
+        template <class F>
+        void sweep (const coor *, const double, F) const;
+    public:
+        // default constructor
+        Grid ();
+        // constructor from a vector of items and the side length of a cell,
+        // which is usually the largest distance that will be searched
+        Grid (const vector<T*>&, const float);
+        // the number of items in the grid
+        size_t size () const {return m_items.size();}
+        // the items whose distance() to an item is less than a radius, not
+        // including the item itself. The neighbors are not sorted
+        vector<T*> radius_neighbors (T*, const float) const;
+        // the same as radius_neighbors, but giving the places of the
+        // neighbors in the vector the grid was made from. The second version
+        // calls a function with each place instead of storing them
+        vector<size_t> radius_indices (T*, const float) const;
+        template <class F>
+        void radius_indices (T*, const float, F) const;
+        // whether or not any item other than the item itself is within a
+        // radius of it
+        bool any_within (T*, const float) const;
+
+    // End the class definition
+};
+
+// Define a preprocessor variable to guarantee that the Grid methods are
+// included here and only here
+#define Grid_Loading_Status 1
+
+// Include the files that implement class methods
+#include "Grid/constructor.h"
+#include "Grid/radius_neighbors.h"
+
+// Undefine the loading status variable
+#undef Grid_Loading_Status
+
+// End the header guard from the start of the file
+#endif
@@ -0,0 +1,98 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file is intended to be included by the Grid.h header file. It implements
+ * the constructors of the Grid class. */
+
+// Confirm that the Grid class is loading the content
+#ifndef Grid_Loading_Status
+#error Grid methods must be included by Grid.h
+#endif
+
+// The default constructor makes an empty grid
+template <typename T>
+PROT::Grid<T>::Grid () {
+    m_starts.push_back(0);
+    m_side = 1;
+    for (size_t k = 0; k < AtomCoordinates; k++) {
+        m_origin[k] = 0;
+        m_cells[k] = 1;
+    }
+}
+
+// Put the items into the cells of a grid
+template <typename T>
+PROT::Grid<T>::Grid (const vector<T*>& items, const float side) {
+    if (!(side > 0)) {
+        string error = "The cells of a Grid must have a positive side length\n";
+        throw PANTZ_error (error);
+    }
+    // get the coordinates of every item once, and the space they take up
+    vector<coor> points;
+    points.reserve(items.size() * AtomCoordinates);
+    double lower [AtomCoordinates], upper [AtomCoordinates];
+    for (size_t k = 0; k < AtomCoordinates; k++) {
+        lower[k] = 0;
+        upper[k] = 0;
+    }
+    for (size_t i = 0; i < items.size(); i++) {
+        const coor point [AtomCoordinates] = {items[i]->x(), items[i]->y(), items[i]->z()};
+        for (size_t k = 0; k < AtomCoordinates; k++) {
+            points.push_back(point[k]);
+            if ((i == 0) || (point[k] < lower[k])) {lower[k] = point[k];}
+            if ((i == 0) || (point[k] > upper[k])) {upper[k] = point[k];}
+        }
+    }
+    // make the cells larger if there would be many more cells than items
+    m_side = side;
+    size_t total = 0;
+    while (true) {
+        total = 1;
+        for (size_t k = 0; k < AtomCoordinates; k++) {
+            m_origin[k] = lower[k];
+            m_cells[k] = (size_t) ((upper[k] - lower[k]) / m_side) + 1;
+            total *= m_cells[k];
+        }
+        if (total <= 8 * items.size() + 64) {
+            break;
+        }
+        m_side *= 1.25;
+    }
+    // count the items in each cell, then turn the counts into offsets
+    vector<size_t> cells (items.size());
+    m_starts.assign(total + 1, 0);
+    for (size_t i = 0; i < items.size(); i++) {
+        const coor * point = &points[AtomCoordinates*i];
+        cells[i] = (cell(point[0], 0) * m_cells[1] + cell(point[1], 1)) * m_cells[2] + cell(point[2], 2);
+        m_starts[cells[i] + 1]++;
+    }
+    for (size_t c = 0; c < total; c++) {
+        m_starts[c + 1] += m_starts[c];
+    }
+    // store the items and their coordinates by cell, keeping their order
+    // within each cell
+    vector<size_t> next (m_starts.begin(), m_starts.end() - 1);
+    m_items.resize(items.size());
+    m_index.resize(items.size());
+    m_points.resize(points.size());
+    for (size_t i = 0; i < items.size(); i++) {
+        size_t place = next[cells[i]]++;
+        m_items[place] = items[i];
+        m_index[place] = i;
+        for (size_t k = 0; k < AtomCoordinates; k++) {
+            m_points[AtomCoordinates*place + k] = points[AtomCoordinates*i + k];
+        }
+    }
+}
+
+// The cell of a coordinate in one dimension
+template <typename T>
+size_t PROT::Grid<T>::cell (const double value, const size_t dimension) const {
+    double position = (value - m_origin[dimension]) / m_side;
+    if (!(position > 0)) {
+        return 0;
+    }
+    if (position >= m_cells[dimension]) {
+        return m_cells[dimension] - 1;
+    }
+    return (size_t) position;
+}
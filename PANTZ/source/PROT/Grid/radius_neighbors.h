@@ -0,0 +1,100 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file is intended to be included by the Grid.h header file. It implements
+ * the functions that find the items near an item. */
+
+// Confirm that the Grid class is loading the content
+#ifndef Grid_Loading_Status
+#error Grid methods must be included by Grid.h
+#endif
+
+// Call a function with the index of every item in the cells that are within a
+// distance of a point, along with its squared distance to the point
+template <typename T>
+template <class F>
+void PROT::Grid<T>::sweep (const coor * query, const double reach, F visit) const {
+    if (m_items.empty()) {
+        return;
+    }
+    size_t low [AtomCoordinates], high [AtomCoordinates];
+    for (size_t k = 0; k < AtomCoordinates; k++) {
+        low[k] = cell(query[k] - reach, k);
+        high[k] = cell(query[k] + reach, k);
+    }
+    for (size_t a = low[0]; a <= high[0]; a++) {
+        for (size_t b = low[1]; b <= high[1]; b++) {
+            // the cells along the z dimension are next to each other, so they
+            // are searched as one range
+            size_t first = (a * m_cells[1] + b) * m_cells[2];
+            size_t start = m_starts[first + low[2]];
+            size_t end = m_starts[first + high[2] + 1];
+            for (size_t i = start; i < end; i++) {
+                const coor * point = &m_points[AtomCoordinates*i];
+                double dx = point[0] - query[0];
+                double dy = point[1] - query[1];
+                double dz = point[2] - query[2];
+                if (!visit(i, dx*dx + dy*dy + dz*dz)) {
+                    return;
+                }
+            }
+        }
+    }
+}
+
+// Get the items within a radius of an item
+template <typename T>
+vector<T*> PROT::Grid<T>::radius_neighbors (T* data, const float radius) const {
+    vector<T*> neighbors;
+    const coor query [AtomCoordinates] = {data->x(), data->y(), data->z()};
+    double inner, outer;
+    radius_limits(radius, inner, outer);
+    sweep(query, sqrt(outer), [&] (size_t i, double squared) {
+        if ((m_items[i] != data) && ((squared < inner) ||
+            ((squared < outer) && (m_items[i]->distance(*data) < radius)))) {
+            neighbors.push_back(m_items[i]);
+        }
+        return true;
+    });
+    return neighbors;
+}
+
+// Call a function with the place of every item within a radius of an item
+template <typename T>
+template <class F>
+void PROT::Grid<T>::radius_indices (T* data, const float radius, F found) const {
+    const coor query [AtomCoordinates] = {data->x(), data->y(), data->z()};
+    double inner, outer;
+    radius_limits(radius, inner, outer);
+    sweep(query, sqrt(outer), [&] (size_t i, double squared) {
+        if ((m_items[i] != data) && ((squared < inner) ||
+            ((squared < outer) && (m_items[i]->distance(*data) < radius)))) {
+            found(m_index[i]);
+        }
+        return true;
+    });
+}
+
+// Get the places of the items within a radius of an item
+template <typename T>
+vector<size_t> PROT::Grid<T>::radius_indices (T* data, const float radius) const {
+    vector<size_t> neighbors;
+    radius_indices(data, radius, [&] (size_t i) {neighbors.push_back(i);});
+    return neighbors;
+}
+
+// Whether or not any item is within a radius of an item
+template <typename T>
+bool PROT::Grid<T>::any_within (T* data, const float radius) const {
+    const coor query [AtomCoordinates] = {data->x(), data->y(), data->z()};
+    double inner, outer;
+    radius_limits(radius, inner, outer);
+    bool found = false;
+    sweep(query, sqrt(outer), [&] (size_t i, double squared) {
+        if ((m_items[i] != data) && ((squared < inner) ||
+            ((squared < outer) && (m_items[i]->distance(*data) < radius)))) {
+            found = true;
+        }
+        return !found;
+    });
+    return found;
+}
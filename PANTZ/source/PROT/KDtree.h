@@ -14,42 +14,45 @@
 #error KDtree.h must be included by Proteins.h
 #endif
 
-// Define the KDtree class
+// Define the KDtree class. The tree is stored in a single array: the items in
+// a range of the array are split on the item in the middle of the range, with
+// the items before it on one side of the splitting plane and the items after
+// it on the other
 template <class T>
 class PROT::KDtree {
     private:
-        // the node struct which contains the data and the left and right children
-        struct Node {
-            T* item;
-            Node* left;
-            Node* right;
-
-            Node(T* d) : item(d), left(nullptr), right(nullptr) {}
-        };
-        size_t dimension; // Dimension to split on: 0 for x, 1 for y, 2 for z
-        // function to build the tree
-        KDtree::Node * build_tree(vector<T*> items, size_t depth);
-        // item pointers for the tree
+        // the items, in tree order
         vector<T*> m_item_ptrs;
-        // the root node
-        Node* root;
+        // the coordinates of each item, 3 per item in the same order, so that
+        // searches do not need to ask the items for them
+        vector<coor> m_points;
+        // function to build the tree from the items in a range of the array,
+        // splitting on a dimension (0 for x, 1 for y, 2 for z) that depends on
+        // the depth
+        void build_tree(vector<size_t>& order, size_t start, size_t end, size_t depth);
+        // whether or not the item at a place in the array is within the radius
+        // of the data, which has the provided coordinates
+        bool within(size_t node, const coor * query, T* data, float radius, double inner, double outer) const;
         // the radius search function
-        void radius_search(Node* node, T* data, float radius, vector<T*>& neighbors, size_t depth=0);
+        void radius_search(T* data, float radius, vector<T*>& neighbors) const;
+        // sort neighbors by their distance to an item, calculating each
+        // distance once
+        static void sort_neighbors(T* data, vector<T*>& neighbors);
     public:
         // default constructor
         KDtree();
         // constructor from a vector of items
         KDtree(vector<T*> data);
-        // destructor
-        ~KDtree();
-        // delete subtree
-        void delete_subtree(Node* node);
+        // the number of items in the tree
+        size_t size() const {return m_item_ptrs.size();}
         // find the nearest neighbor
         vector<T*> nearest_neighbors(T* data, size_t num_neighbors);
-        // radius neighbors
-        vector<T*> radius_neighbors(T* data, float radius);
+        // radius neighbors. This does not change the tree, so one tree may be
+        // searched by several threads at once. The neighbors are sorted by
+        // their distance to the item unless the boolean is false
+        vector<T*> radius_neighbors(T* data, float radius, bool sorted = true) const;
         // get the items in the tree
-        void get_items(Node* node, vector<T*>& data);
+        void get_items(vector<T*>& data) const;
 
     // End the class definition
 };
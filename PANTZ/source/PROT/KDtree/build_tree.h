@@ -8,47 +8,25 @@
 #error KDtree methods must be included by KDtree.h
 #endif
 
-// build the tree for the KDtree class
+// build the tree for the KDtree class by rearranging the indices of the items
+// in a range so that the median item on the splitting dimension is in the middle
+// of the range, then doing the same to each half
 template <typename T>
-typename PROT::KDtree<T>::Node* PROT::KDtree<T>::build_tree(vector<T*> items, size_t depth) {
-    if (items.empty()) {
-        return nullptr;
+void PROT::KDtree<T>::build_tree(vector<size_t>& order, size_t start, size_t end, size_t depth) {
+    if (end - start <= 1) {
+        return;
     }
 
     size_t axis = depth % 3;
+    const vector<coor>& points = this->m_points;
 
-    // Sort items based on the dimension
-    if (axis == 0) {
-        sort(items.begin(), items.end(), [](T* a, T* b) {
-            return a->x() < b->x();
-        });
-    } else if (axis == 1) {
-        sort(items.begin(), items.end(), [](T* a, T* b) {
-            return a->y() < b->y();
-        });
-    } else {
-        sort(items.begin(), items.end(), [](T* a, T* b) {
-            return a->z() < b->z();
-        });
-    }
-
-    size_t median = items.size() / 2;
-    PROT::KDtree<T>::Node* node = new PROT::KDtree<T>::Node(items[median]);
+    // only the median needs to be in its sorted position
+    size_t median = start + (end - start) / 2;
+    nth_element(order.begin() + start, order.begin() + median, order.begin() + end,
+                [&points, axis](size_t a, size_t b) {
+        return points[AtomCoordinates*a + axis] < points[AtomCoordinates*b + axis];
+    });
     // left and right children
-    vector<T*> left_items(items.begin(), items.begin() + median);
-    vector<T*> right_items(items.begin() + median + 1, items.end());
-    node->left = build_tree(left_items, depth + 1);
-    node->right = build_tree(right_items, depth + 1);
-    return node;
-}
-
-// delete subtree for KDtree class with template type
-template <typename T>
-void PROT::KDtree<T>::delete_subtree(Node* node) {
-    if (node == nullptr) {
-        return;
-    }
-    delete_subtree(node->left);
-    delete_subtree(node->right);
-    delete node;
+    build_tree(order, start, median, depth + 1);
+    build_tree(order, median + 1, end, depth + 1);
 }
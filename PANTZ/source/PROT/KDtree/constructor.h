@@ -11,18 +11,34 @@
 // The constructor of the KDtree class that instantiates the class
 template <typename T>
 PROT::KDtree<T>::KDtree () {
-    this->root = nullptr;
 }
 
 // constructor for kdtree class with vector of template type
 template <typename T>
 PROT::KDtree<T>::KDtree (vector<T*> items) {
-    this->m_item_ptrs = items;
-    this->root = build_tree(items, 0);
-}
-
-// destructor for the kdtree class (i know its called constructor.h leave me alone)
-template <typename T>
-PROT::KDtree<T>::~KDtree () {
-    delete_subtree(this->root);
+    // get the coordinates of every item once
+    vector<coor> points;
+    points.reserve(items.size() * AtomCoordinates);
+    for (size_t i = 0; i < items.size(); i++) {
+        points.push_back(items[i]->x());
+        points.push_back(items[i]->y());
+        points.push_back(items[i]->z());
+    }
+    this->m_points.swap(points);
+    // arrange the items into tree order
+    vector<size_t> order (items.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        order[i] = i;
+    }
+    build_tree(order, 0, order.size(), 0);
+    // store the items and their coordinates in that order
+    this->m_item_ptrs.resize(items.size());
+    points.resize(this->m_points.size());
+    for (size_t i = 0; i < order.size(); i++) {
+        this->m_item_ptrs[i] = items[order[i]];
+        for (size_t k = 0; k < AtomCoordinates; k++) {
+            points[AtomCoordinates*i + k] = this->m_points[AtomCoordinates*order[i] + k];
+        }
+    }
+    this->m_points.swap(points);
 }
@@ -17,13 +17,13 @@ vector<T*> PROT::KDtree<T>::nearest_neighbors(T* item_ptr, size_t num_neighbors)
     }
     vector<T*> neighbors;
     vector<T*> items;
-    get_items(this->root, items);
+    get_items(items);
     // sort the items based on the distance from the item_ptr
     sort(items.begin(), items.end(), [item_ptr](T* a, T* b) {
         return item_ptr->distance(*a) < item_ptr->distance(*b);
     });
     // get the first num_neighbors items
-    for (size_t i = 0; i < num_neighbors; i++) {
+    for (size_t i = 0; (i < num_neighbors) && (i < items.size()); i++) {
         neighbors.push_back(items[i]);
     }
     return neighbors;
@@ -31,11 +31,6 @@ vector<T*> PROT::KDtree<T>::nearest_neighbors(T* item_ptr, size_t num_neighbors)
 
 // get items for kdtree class with template type
 template <typename T>
-void PROT::KDtree<T>::get_items(Node* node, vector<T*>& items) {
-    if (node == nullptr) {
-        return;
-    }
-    items.push_back(node->item);
-    get_items(node->left, items);
-    get_items(node->right, items);
-}
\ No newline at end of file
+void PROT::KDtree<T>::get_items(vector<T*>& items) const {
+    items.insert(items.end(), m_item_ptrs.begin(), m_item_ptrs.end());
+}
@@ -10,108 +10,92 @@
 
 // get the nearest neighbors
 template <typename T>
-vector<T*> PROT::KDtree<T>::radius_neighbors(T* item_ptr, float radius) {
+vector<T*> PROT::KDtree<T>::radius_neighbors(T* item_ptr, float radius, bool sorted) const {
     // handle null pointer
-    if (root == nullptr) {
+    if (m_item_ptrs.empty()) {
         return vector<T*>();
     }
     // get the neighbors
     vector<T*> neighbors;
-    radius_search(root, item_ptr, radius, neighbors);
+    radius_search(item_ptr, radius, neighbors);
     // sort the neighbors by distance to the item
-    sort(neighbors.begin(), neighbors.end(), [item_ptr](T* a, T* b) {
-        return a->distance(*item_ptr) < b->distance(*item_ptr);
-    });
+    if (sorted) {
+        sort_neighbors(item_ptr, neighbors);
+    }
     // remove this item from the neighbors
     neighbors.erase(remove(neighbors.begin(), neighbors.end(), item_ptr), neighbors.end());
     // return the neighbors
     return neighbors;
 }
 
-// // radius search
-// template <typename T>
-// void PROT::KDtree<T>::radius_search(Node* node, T* data, float radius, vector<T*>& neighbors, size_t depth) {
-//     // handle null pointer
-//     if (node == nullptr) {
-//         return;
-//     }
-//     // get the dimension
-//     size_t dim = depth % 3;
-//     // get the distance between the node and the data
-//     float dist = node->item->distance(*data);
-//     // if the distance is less than the radius, add the node to the neighbors
-//     if (dist < radius) {
-//         neighbors.push_back(node->item);
-//     }
-//     // if dim is 0, check the x coordinate, if 1, check the y coordinate, if 2, check the z coordinate
-//     if (dim == 0) {
-//         // if the distance is less than the radius, search the left and right children
-//         if (node->left != nullptr and node->item->x() - data->x() > -radius) {
-//             radius_search(node->left, data, radius, neighbors, depth + 1);
-//         }
-//         if (node->right != nullptr and node->item->x() - data->x() < radius) {
-//             radius_search(node->right, data, radius, neighbors, depth + 1);
-//         }
-//     } else if (dim == 1) {
-//         // if the distance is less than the radius, search the left and right children
-//         if (node->left != nullptr and node->item->y() - data->y() > -radius) {
-//             radius_search(node->left, data, radius, neighbors, depth + 1);
-//         }
-//         if (node->right != nullptr and node->item->y() - data->y() < radius) {
-//             radius_search(node->right, data, radius, neighbors, depth + 1);
-//         }
-//     } else {
-//         // if the distance is less than the radius, search the left and right children
-//         if (node->left != nullptr and node->item->z() - data->z() > -radius) {
-//             radius_search(node->left, data, radius, neighbors, depth + 1);
-//         }
-//         if (node->right != nullptr and node->item->z() - data->z() < radius) {
-//             radius_search(node->right, data, radius, neighbors, depth + 1);
-//         }
-//     }
-// }
-
+// sort neighbors by distance to an item
 template <typename T>
-void PROT::KDtree<T>::radius_search(Node* node, T* data, float radius, vector<T*>& neighbors, size_t depth) {
-    // handle null pointer
-    if (node == nullptr) {
-        return;
+void PROT::KDtree<T>::sort_neighbors(T* item_ptr, vector<T*>& neighbors) {
+    vector<pair<float, T*> > distances;
+    distances.reserve(neighbors.size());
+    for (size_t i = 0; i < neighbors.size(); i++) {
+        distances.push_back(make_pair(neighbors[i]->distance(*item_ptr), neighbors[i]));
     }
-
-    // get the dimension
-    size_t dim = depth % 3;
-
-    // get the distance between the node and the data
-    float dist = node->item->distance(*data);
-
-    // if the distance is less than the radius, add the node to the neighbors
-    if (dist < radius) {
-        neighbors.push_back(node->item);
+    sort(distances.begin(), distances.end(), [](const pair<float, T*>& a, const pair<float, T*>& b) {
+        return a.first < b.first;
+    });
+    for (size_t i = 0; i < neighbors.size(); i++) {
+        neighbors[i] = distances[i].second;
     }
+}
 
-    // check which side of the splitting plane the data point lies on
-    float diff;
-    if (dim == 0) {
-        diff = data->x() - node->item->x();
-    } else if (dim == 1) {
-        diff = data->y() - node->item->y();
-    } else {
-        diff = data->z() - node->item->z();
+// whether or not an item's distance() to the data is less than the radius
+template <typename T>
+bool PROT::KDtree<T>::within(size_t node, const coor * query, T* data, float radius, double inner, double outer) const {
+    const coor * point = &m_points[AtomCoordinates*node];
+    double dx = point[0] - query[0];
+    double dy = point[1] - query[1];
+    double dz = point[2] - query[2];
+    double squared = dx*dx + dy*dy + dz*dz;
+    if (squared < inner) {
+        return true;
     }
+    return ((squared < outer) && (m_item_ptrs[node]->distance(*data) < radius));
+}
 
-    if (diff <= 0) {
-        // search the left subtree
-        radius_search(node->left, data, radius, neighbors, depth + 1);
-        // if there could be points on the right within the radius, search the right subtree
-        if (diff * diff < radius * radius) {
-            radius_search(node->right, data, radius, neighbors, depth + 1);
+// find every item whose distance() to the data is less than the radius. The
+// ranges of the array that still need to be searched are kept on a stack
+template <typename T>
+void PROT::KDtree<T>::radius_search(T* data, float radius, vector<T*>& neighbors) const {
+    const coor query[AtomCoordinates] = {data->x(), data->y(), data->z()};
+    double inner, outer;
+    radius_limits(radius, inner, outer);
+    // each range is its start, its end, and its depth in the tree
+    struct Range {size_t start, end, depth;};
+    vector<Range> stack;
+    stack.push_back(Range {0, m_item_ptrs.size(), 0});
+    while (!stack.empty()) {
+        Range range = stack.back();
+        stack.pop_back();
+        if (range.start >= range.end) {
+            continue;
         }
-    } else {
-        // search the right subtree
-        radius_search(node->right, data, radius, neighbors, depth + 1);
-        // if there could be points on the left within the radius, search the left subtree
-        if (diff * diff < radius * radius) {
-            radius_search(node->left, data, radius, neighbors, depth + 1);
+        size_t node = range.start + (range.end - range.start) / 2;
+
+        // if the distance is less than the radius, add the node to the neighbors
+        if (within(node, query, data, radius, inner, outer)) {
+            neighbors.push_back(m_item_ptrs[node]);
+        }
+
+        // check which side of the splitting plane the data point lies on
+        size_t dim = range.depth % 3;
+        float diff = query[dim] - m_points[AtomCoordinates*node + dim];
+        Range left {range.start, node, range.depth + 1};
+        Range right {node + 1, range.end, range.depth + 1};
+        // search the side the data is on, and the other side if there could
+        // be points on it within the radius
+        bool both = ((double) diff * diff < outer);
+        if (diff <= 0) {
+            if (both) {stack.push_back(right);}
+            stack.push_back(left);
+        } else {
+            if (both) {stack.push_back(left);}
+            stack.push_back(right);
         }
     }
 }
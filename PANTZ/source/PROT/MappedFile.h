@@ -0,0 +1,112 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file contains the declaration and implementation of the MappedFile
+ * class. A MappedFile maps the contents of a file into memory so they can be
+ * read in place, instead of being copied line by line into strings first.
+ * Files that can't be mapped, such as pipes, are read into memory instead. */
+
+// Use a header guard to make sure this file is only included in a compiled
+// program a single time
+#ifndef Proteins_MappedFile_Guard
+#define Proteins_MappedFile_Guard 1
+
+// Make sure this file is being included from the Proteins.h header file
+#ifndef Proteins_Loading_Status
+#error MappedFile.h must be included by Proteins.h
+#endif
+
+// The POSIX functions that open and map files
+#include <cerrno>
+#include <cstdint>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Define the MappedFile class
+class PROT::MappedFile {
+
+    // The information stored in the class is private
+    private:
+        // The contents of the file and how many characters there are
+        const char * m_data;
+        size_t m_size;
+        // The mapping, if the file was mapped
+        void * m_map;
+        // The contents, if the file had to be read instead
+        vector<char> m_buffer;
+        // A MappedFile owns its mapping, so it can not be copied
+        MappedFile (const MappedFile&);
+        MappedFile& operator= (const MappedFile&);
+
+    // The public interface of the class
+    public:
+        // The class constructor and destructor
+        MappedFile () : m_data (""), m_size (0), m_map (0) {}
+        ~MappedFile () {close();}
+        // Open a file, returning whether or not that was possible
+        bool open (const string&);
+        // Release the file's contents
+        void close ();
+        // A hash of the contents, which changes whenever they do
+        uint64_t hash () const;
+        // Access to the contents
+        const char * data () const {return m_data;}
+        size_t size () const {return m_size;}
+
+    // End the class definition
+};
+
+// Map a file into memory
+bool PROT::MappedFile::open (const string& fileName) {
+    close();
+    int fd = ::open(fileName.c_str(), O_RDONLY);
+    if (fd < 0) {return false;}
+    struct stat info;
+    if (fstat(fd, &info) != 0) {::close(fd); return false;}
+    // Regular files are mapped. An empty file has nothing to map
+    if ((S_ISREG(info.st_mode)) && (info.st_size > 0)) {
+        void * map = mmap(0, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (map != MAP_FAILED) {
+            m_map = map;
+            m_data = static_cast<const char *>(map);
+            m_size = info.st_size;
+            ::close(fd);
+            return true;}}
+    // Anything else is read into memory
+    char chunk [65536];
+    ssize_t n;
+    while ((n = ::read(fd, chunk, sizeof(chunk))) != 0) {
+        if (n < 0) {
+            if (errno == EINTR) {continue;}
+            ::close(fd); close(); return false;}
+        m_buffer.insert(m_buffer.end(), chunk, chunk + n);}
+    ::close(fd);
+    if (m_buffer.size() > 0) {m_data = &(m_buffer[0]);}
+    m_size = m_buffer.size();
+    return true;
+}
+
+// Release the mapping or the memory the contents were read into
+void PROT::MappedFile::close () {
+    if (m_map != 0) {munmap(m_map, m_size);}
+    m_map = 0;
+    m_data = "";
+    m_size = 0;
+    vector<char>().swap(m_buffer);
+}
+
+// An FNV-1a hash of the contents, taken 8 characters at a time
+uint64_t PROT::MappedFile::hash () const {
+    const uint64_t prime = 1099511628211ULL;
+    uint64_t h = 14695981039346656037ULL ^ m_size;
+    size_t i = 0;
+    for(; i + 8 <= m_size; i += 8) {
+        uint64_t word; memcpy(&word, m_data + i, 8);
+        h = (h ^ word) * prime;}
+    for(; i<m_size; ++i) {h = (h ^ (unsigned char) m_data[i]) * prime;}
+    return h;
+}
+
+// End the header guard
+#endif
@@ -100,6 +100,8 @@ class PROT::Matrix {
         void move_check () const;
         // Confirm that a matrix can be used to rotate atoms
         void rotate_check () const;
+        // Rotate a set of coordinates without checking the matrix first
+        void rotate_coordinates (coor []) const;
         // A string representation of the Matrix
         string str () const;
         // Calculate the rotation matrix to rotate this matrix to the reference
@@ -125,6 +127,7 @@ class PROT::Matrix {
 #include "Matrix/set.h"
 #include "Matrix/add.h"
 #include "Matrix/product.h"
+#include "Matrix/rotate.h"
 #include "Matrix/unit_vector.h"
 #include "Matrix/transpose.h"
 #include "Matrix/str.h"
@@ -0,0 +1,27 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file is intended to be included in a compiled program by the main
+ * Matrix.h header file for this class. The file contains the implementation of
+ * the rotate_coordinates method of the class. */
+
+// Error check the inclusion chain for the file
+#ifndef Matrix_Loading_Status
+#error Matrix methods must be included by the Matrix.h header file
+#endif
+
+// Rotate a set of coordinates (such as an Atom's or a rotamer atom's) with
+// this matrix
+void PROT::Matrix::rotate_coordinates (coor coordinates []) const {
+    // Create an array of the new coordinates
+    coor newCoors [AtomCoordinates];
+    // Calculate the new coordinates
+    for(size_t i=0; i<AtomCoordinates; ++i) {
+        // Set the new coordinate value to 0
+        newCoors[i] = 0;
+        // Loop through the current coordinates
+        for(size_t j=0; j<AtomCoordinates; ++j) {
+            // Add the appropriate product value to the new coordinate
+            newCoors[i] += (operator()(i, j) * coordinates[j]);}}
+    // Store the new coordinates
+    for(size_t i=0; i<AtomCoordinates; ++i) {coordinates[i] = newCoors[i];}
+}
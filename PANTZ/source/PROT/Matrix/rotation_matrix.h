@@ -24,29 +24,20 @@ PROT::Matrix PROT::Matrix::rotation_matrix (const Matrix * other) const {
                      + c1.str() + "x" + c2.str() + " matrix and a "
                      + c3.str() + "x" + c4.str() + " matrix.\n";
         throw PANTZ_error (error);}
-    // turn this matrix into an Eigen matrix
-    Eigen::MatrixXf target(m_rows, m_columns);
-    for (size_t i=0; i<m_rows; ++i) {
-        for (size_t j=0; j<m_columns; ++j) {
-            target(i, j) = operator()(i, j);
-        }
-    }
-    // turn the other matrix into an Eigen matrix
-    Eigen::MatrixXf reference(other->m_rows, other->m_columns);
-    for (size_t i=0; i<other->m_rows; ++i) {
-        for (size_t j=0; j<other->m_columns; ++j) {
-            reference(i, j) = other->operator()(i, j);
-        }
-    }
+    // use the values of both matrices in place, since they are stored one row
+    // after another
+    typedef Eigen::Map<const Eigen::Matrix<coor, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor> > Values;
+    Values target(m_values, m_rows, m_columns);
+    Values reference(other->m_values, other->m_rows, other->m_columns);
     // get the centroid of the reference protein
     Eigen::Vector3f ref_centroid = reference.colwise().mean();
     // get the centroid of the target protein
     Eigen::Vector3f target_centroid = target.colwise().mean();
     // translate the proteins to the origin (for calculation only, doesnt change the protein)
-    reference.rowwise() -= ref_centroid.transpose();
-    target.rowwise() -= target_centroid.transpose();
+    Eigen::MatrixXf centered_reference = reference.rowwise() - ref_centroid.transpose();
+    Eigen::MatrixXf centered_target = target.rowwise() - target_centroid.transpose();
     // calculate the covariance matrix
-    Eigen::MatrixXf covariance = target.transpose() * reference;
+    Eigen::MatrixXf covariance = centered_target.transpose() * centered_reference;
     // calculate the singular value decomposition
     Eigen::JacobiSVD<Eigen::MatrixXf> svd(covariance, Eigen::ComputeThinU | Eigen::ComputeThinV);
     // calculate the rotation matrix
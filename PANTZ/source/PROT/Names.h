@@ -0,0 +1,116 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file contains the declaration and implementation of the Names class. It
+ * interns the short strings that every Atom carries (its name, its residue's
+ * name, its element and its charge), so that an Atom only stores a small
+ * integer ID for each of them and two names can be compared by comparing their
+ * IDs. The strings are kept in fixed size chunks that are never moved, so the
+ * text of an ID can be read by any thread without a lock while other threads
+ * are adding new names. */
+
+// Use a header guard to make sure this file is only included in a compiled
+// program a single time
+#ifndef Proteins_Names_Guard
+#define Proteins_Names_Guard 1
+
+// Make sure this file is being included from the Proteins.h header file
+#ifndef Proteins_Loading_Status
+#error Names.h must be included by Proteins.h
+#endif
+
+// Names may be interned by several threads at once
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+
+// Define the Names class. Everything in it is static, so there is one table of
+// names for the whole program
+class PROT::Names {
+
+    // The public interface of the class
+    public:
+        // The type of an interned name's ID
+        typedef uint16_t ID;
+        // The names that are interned before any others, so that their IDs are
+        // known without looking them up. These are the elements that the
+        // energy terms check for and the names a new Atom is given
+        enum Fixed {Empty = 0, H, C, N, O, S, NoName, NoResidue};
+        // Get the ID of a name, adding it to the table if it is not there yet
+        static ID intern (const string&);
+        // The text of an ID
+        static const string& text (const ID id) {
+            const Table& names = table();
+            return names.chunks[id / ChunkSize].load(memory_order_acquire)[id % ChunkSize];}
+
+    // The information stored in the class is private
+    private:
+        // The names are stored in chunks of this many strings, and there can
+        // be this many chunks
+        static const size_t ChunkSize = 256;
+        static const size_t Chunks = 256;
+        // The table of interned names
+        struct Table {
+            // The lock that guards adding names
+            mutex lock;
+            // The ID of every name that has been interned
+            unordered_map<string, ID> index;
+            // The chunks of strings. A chunk is allocated when it is first
+            // needed and is never moved or removed until the program ends
+            atomic<string *> chunks [Chunks];
+            // The number of interned names
+            size_t count;
+            // Set up the table and intern the fixed names
+            Table ();
+            // Delete the chunks
+            ~Table () {
+                for(size_t i=0; i<Chunks; ++i) {delete [] chunks[i].load();}}
+            // Add a name that is not in the table yet. The lock must be held
+            ID add (const string&);
+        };
+        // The table, which is created the first time it is needed
+        static Table& table () {
+            static Table names;
+            return names;}
+
+    // End the class definition
+};
+
+// Set up the table of names and intern the fixed names in the order of the
+// Fixed enum
+PROT::Names::Table::Table () {
+    count = 0;
+    for(size_t i=0; i<Chunks; ++i) {chunks[i].store(nullptr);}
+    const char * fixed [] = {"", "H", "C", "N", "O", "S", "NONE", "NON"};
+    for(size_t i=0; i<8; ++i) {add(fixed[i]);}
+}
+
+// Add a name to the table and return its ID
+PROT::Names::ID PROT::Names::Table::add (const string& name) {
+    if (count == Chunks * ChunkSize) {
+        string error = "There are too many different atom, residue, element "
+                       "and charge names to store another: " + name + "\n";
+        throw PANTZ_error (error);}
+    size_t chunk = count / ChunkSize;
+    string * strings = chunks[chunk].load(memory_order_relaxed);
+    if (strings == nullptr) {
+        strings = new string [ChunkSize];
+        chunks[chunk].store(strings, memory_order_release);}
+    strings[count % ChunkSize] = name;
+    ID id = count;
+    index[name] = id;
+    ++count;
+    return id;
+}
+
+// Get the ID of a name, adding it to the table if needed
+PROT::Names::ID PROT::Names::intern (const string& name) {
+    Table& names = table();
+    lock_guard<mutex> guard (names.lock);
+    unordered_map<string, ID>::const_iterator it = names.index.find(name);
+    if (it != names.index.end()) {return it->second;}
+    return names.add(name);
+}
+
+// End the header guard from the start of the file
+#endif
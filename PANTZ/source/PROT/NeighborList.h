@@ -0,0 +1,89 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file contains the declaration of the NeighborList class. It is a Verlet
+ * neighbor list: for every item, it stores the places of the items that were
+ * within a cutoff plus a "skin" distance when the list was built. As long as
+ * neither item of a pair has moved by half of the skin, the pair can only be
+ * within the cutoff if it is in the list, so the list can be used again for
+ * items that have moved a little (such as the members of an ensemble of
+ * structures) without searching for neighbors again. The items are referred to
+ * by their places in a vector, so the list can be used with copies of the
+ * items, as long as they are in the same order. Like the Grid, the items must
+ * have x(), y(), z() and distance() methods. The file also includes the header
+ * files where the methods of the class are implemented. */
+
+// Use a header guard to make sure this file is only included in a compiled
+// program a single time
+#ifndef Proteins_NeighborList_Guard
+#define Proteins_NeighborList_Guard 1
+
+// Make sure this file is being included from the Proteins.h header file
+#ifndef Proteins_Loading_Status
+#error NeighborList.h must be included by Proteins.h
+#endif
+
+// Define the NeighborList class
+template <class T>
+class PROT::NeighborList {
+    private:
+        // the items the list is currently used for
+        vector<T*> m_items;
+        // the neighbors of item i are m_neighbors[m_starts[i]] up to (but not
+        // including) m_neighbors[m_starts[i+1]]
+        vector<size_t> m_starts;
+        vector<size_t> m_neighbors;
+        // the coordinates of every item when the list was built, 3 per item
+        vector<coor> m_reference;
+        // the largest distance that can be searched for, and the skin
+        float m_cutoff;
+        float m_skin;
+        // the items that have moved by half of the skin or more since the list
+        // was built. Their neighbors are found with grids of the current
+        // positions instead: one of every item and one of the moved items
+        vector<bool> m_moved;
+        vector<size_t> m_movers;
+        Grid<T> m_all_grid;
+        Grid<T> m_moved_grid;
+        // whether the list has to be built the next time it is updated
+        bool m_stale;
+        // the number of times the list has been built
+        size_t m_builds;
+        // build the list from the current positions of the items
+        void build ();
+    public:
+        // constructor from the cutoff and skin distances
+        NeighborList (const float cutoff = 0, const float skin = 0);
+        // access to the list's information
+        float cutoff () const {return m_cutoff;}
+        float skin () const {return m_skin;}
+        size_t size () const {return m_items.size();}
+        size_t builds () const {return m_builds;}
+        // make sure the list is built again the next time it is updated, such
+        // as when the items are not the same as before
+        void clear () {m_stale = true;}
+        // use the list for the current positions of the items, which must be
+        // the same as (or copies of) the items it was last used for, in the
+        // same order. The list is built again if the number of items changed or
+        // too many of them have moved. Returns whether it was built again
+        bool update (const vector<T*>&);
+        // the places of the items whose distance() to item i is less than a
+        // radius, which can not be more than the cutoff. Item i is not
+        // included and the neighbors are not sorted
+        vector<size_t> neighbors (const size_t, const float) const;
+
+    // End the class definition
+};
+
+// Define a preprocessor variable to guarantee that the NeighborList methods
+// are included here and only here
+#define NeighborList_Loading_Status 1
+
+// Include the files that implement class methods
+#include "NeighborList/update.h"
+#include "NeighborList/neighbors.h"
+
+// Undefine the loading status variable
+#undef NeighborList_Loading_Status
+
+// End the header guard from the start of the file
+#endif
@@ -0,0 +1,44 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file is intended to be included by the NeighborList.h header file. It
+ * implements the function that gets the neighbors of an item from the list. */
+
+// Confirm that the NeighborList class is loading the content
+#ifndef NeighborList_Loading_Status
+#error NeighborList methods must be included by NeighborList.h
+#endif
+
+// The places of the items within a radius of item i
+template <typename T>
+vector<size_t> PROT::NeighborList<T>::neighbors (const size_t i, const float radius) const {
+    if (i >= m_items.size()) {
+        string error = "Item " + to_string(i) + " is not in a NeighborList of "
+                     + to_string(m_items.size()) + " items\n";
+        throw PANTZ_error (error);
+    }
+    if (radius > m_cutoff) {
+        string error = "A NeighborList with a cutoff of " + to_string(m_cutoff)
+                     + " can not find the neighbors within " + to_string(radius) + "\n";
+        throw PANTZ_error (error);
+    }
+    // an item that has moved too far is searched for in the grid of every item
+    if (m_moved[i]) {
+        return m_all_grid.radius_indices(m_items[i], radius);
+    }
+    // otherwise its neighbors that have not moved too far are in the list, and
+    // the ones that have are searched for in the grid of the moved items
+    vector<size_t> found;
+    for (size_t k = m_starts[i]; k < m_starts[i+1]; k++) {
+        size_t j = m_neighbors[k];
+        if ((!m_moved[j]) && (m_items[j]->distance(*m_items[i]) < radius)) {
+            found.push_back(j);
+        }
+    }
+    if (!m_movers.empty()) {
+        vector<size_t> moved = m_moved_grid.radius_indices(m_items[i], radius);
+        for (size_t k = 0; k < moved.size(); k++) {
+            found.push_back(m_movers[moved[k]]);
+        }
+    }
+    return found;
+}
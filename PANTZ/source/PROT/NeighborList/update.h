@@ -0,0 +1,98 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file is intended to be included by the NeighborList.h header file. It
+ * implements the functions that build the list and check how far the items
+ * have moved since then. */
+
+// Confirm that the NeighborList class is loading the content
+#ifndef NeighborList_Loading_Status
+#error NeighborList methods must be included by NeighborList.h
+#endif
+
+// The constructor only stores the distances. The list is built by update
+template <typename T>
+PROT::NeighborList<T>::NeighborList (const float cutoff, const float skin) {
+    if ((cutoff < 0) || (skin < 0)) {
+        string error = "The cutoff and skin of a NeighborList can not be negative\n";
+        throw PANTZ_error (error);
+    }
+    m_cutoff = cutoff;
+    m_skin = skin;
+    m_stale = true;
+    m_builds = 0;
+}
+
+// Find the neighbors of every item within the cutoff plus the skin
+template <typename T>
+void PROT::NeighborList<T>::build () {
+    m_reference.clear();
+    m_reference.reserve(m_items.size() * AtomCoordinates);
+    for (size_t i = 0; i < m_items.size(); i++) {
+        m_reference.push_back(m_items[i]->x());
+        m_reference.push_back(m_items[i]->y());
+        m_reference.push_back(m_items[i]->z());
+    }
+    // no item has moved since the list was built
+    m_moved.assign(m_items.size(), false);
+    m_movers.clear();
+    m_all_grid = Grid<T> ();
+    m_moved_grid = Grid<T> ();
+    // the grid needs a positive cell size, even if the list is for items that
+    // are at the same place
+    float reach = m_cutoff + m_skin;
+    Grid<T> grid (m_items, (reach > 0) ? reach : 1);
+    m_starts.assign(1, 0);
+    m_starts.reserve(m_items.size() + 1);
+    m_neighbors.clear();
+    for (size_t i = 0; i < m_items.size(); i++) {
+        grid.radius_indices(m_items[i], reach, [&] (size_t j) {m_neighbors.push_back(j);});
+        m_starts.push_back(m_neighbors.size());
+    }
+    m_stale = false;
+    m_builds++;
+}
+
+// Use the list for the current positions of the items
+template <typename T>
+bool PROT::NeighborList<T>::update (const vector<T*>& items) {
+    bool rebuild = (m_stale || (items.size() != m_items.size()));
+    m_items = items;
+    if (rebuild) {
+        build();
+        return true;
+    }
+    // find the items that have moved by half of the skin or more. The limit is
+    // made a little smaller so that rounding can not matter
+    double limit = m_skin / 2.0 - 1e-3;
+    limit = (limit > 0) ? limit * limit : 0;
+    m_movers.clear();
+    for (size_t i = 0; i < m_items.size(); i++) {
+        const coor * start = &m_reference[AtomCoordinates*i];
+        double dx = m_items[i]->x() - start[0];
+        double dy = m_items[i]->y() - start[1];
+        double dz = m_items[i]->z() - start[2];
+        m_moved[i] = (dx*dx + dy*dy + dz*dz > limit);
+        if (m_moved[i]) {
+            m_movers.push_back(i);
+        }
+    }
+    // if many items have moved, searching for their neighbors one at a time
+    // would take longer than building the list again
+    if (4 * m_movers.size() > m_items.size()) {
+        build();
+        return true;
+    }
+    m_all_grid = Grid<T> ();
+    m_moved_grid = Grid<T> ();
+    if (!m_movers.empty()) {
+        vector<T*> moved;
+        moved.reserve(m_movers.size());
+        for (size_t i = 0; i < m_movers.size(); i++) {
+            moved.push_back(m_items[m_movers[i]]);
+        }
+        float side = (m_cutoff > 0) ? m_cutoff : 1;
+        m_all_grid = Grid<T> (m_items, side);
+        m_moved_grid = Grid<T> (moved, side);
+    }
+    return false;
+}
@@ -27,8 +27,44 @@ class PROT::PDB {
         string m_name;
         // The folder the file is located in
         string m_folder;
-        // The contents of that file
+        // The header records of that file, which are its lines other than the
+        // Atoms and the lines of the models after the first one
         vector<string> m_lines;
+        // The Atoms read from the file while it is loaded, sorted by their
+        // Protein's name. They are moved into the Proteins when those are
+        // constructed, so they are always empty afterwards
+        vector<vector<Atom> > m_atoms;
+        // When the file has several models, the Proteins are made from the
+        // first one and the coordinates of every model are kept here. The
+        // coordinates are in the order of the first model's Atoms, which are
+        // listed by their Protein, Residue and name. A model that does not
+        // have the same Atoms as the first one has no coordinates, and its
+        // own Atoms are kept instead so that Proteins can be made from them
+        struct ModelAtom {
+            char protein;
+            char insertion;
+            long residue;
+            Names::ID name;
+            bool operator== (const ModelAtom& other) const {
+                return ((protein == other.protein) &&
+                        (insertion == other.insertion) &&
+                        (residue == other.residue) && (name == other.name));}
+        };
+        vector<ModelAtom> m_topology;
+        vector<vector<coor> > m_models;
+        vector<vector<Atom> > m_model_atoms;
+        // The Proteins made from the first model, which are kept here while
+        // the Proteins of a model with different Atoms are used
+        vector<Protein> m_first_model;
+        // Where each of the first model's Atoms is in the Proteins, by the
+        // indices of its Protein, Residue and Atom. Atoms that are not in the
+        // Proteins have a Protein index of m_proteins.size() or more
+        struct ModelPlace {
+            size_t protein;
+            size_t residue;
+            size_t atom;
+        };
+        vector<ModelPlace> m_places;
         // The type of experiment used to generate the information
         string m_type;
         // The resolution of the experimental data
@@ -41,13 +77,35 @@ class PROT::PDB {
         bool m_obsolete;
         // Whether or not the PDB file is a theoretical structure
         bool m_theoretical;
+        // Whether or not the file is an mmCIF file instead of a PDB file
+        bool m_mmcif;
+        // The chains of an mmCIF file whose names are longer than a single
+        // character, by the name of the Protein they were loaded as
+        map<char, string> m_chains;
 
     // Private functions that control behaviour of the class
     private:
         // Copy information from another instance of this class
         void copy (const PDB *);
+        // Take the information from a PDB that is about to be destroyed
+        void take (PDB&);
         // Load the contents of the file
         void load ();
+        // Load the contents of a PDB or mmCIF file from its text
+        void load_pdb (const char *, const size_t);
+        void load_mmcif (const char *, const size_t);
+        // Identify an Atom of a model, and line the Atoms of the models after
+        // the first one up with the first one's
+        static ModelAtom model_atom (const Atom&);
+        static bool model_order (const Atom&, const Atom&);
+        void collect_models (vector<vector<Atom> >&);
+        // Find where the first model's Atoms are in the Proteins
+        void place_models ();
+        // Keep what was loaded from a file in a binary cache, which is used
+        // instead of the file as long as the file's contents are unchanged
+        static string cache_name (const uint64_t, const size_t);
+        bool load_cache (const string&, const uint64_t, const size_t);
+        void save_cache (const string&, const uint64_t, const size_t) const;
         // Identify the experiment type
         void identify_type();
         // Identify the experiment's resolution
@@ -81,8 +139,13 @@ class PROT::PDB {
         // Copy construction and assignment
         PDB (const PDB& other) {copy(&other);}
         PDB (const PDB * other) {copy(other);}
-        void operator= (const PDB& other) {copy(&other);}
-        void operator= (const PDB * other) {copy(other);}
+        PDB& operator= (const PDB& other) {copy(&other); return *this;}
+        PDB& operator= (const PDB * other) {copy(other); return *this;}
+        // Move construction and assignment
+        PDB (PDB&& other) noexcept {take(other);}
+        PDB& operator= (PDB&& other) noexcept {
+            if (this != &other) {take(other);}
+            return *this;}
         // Access to the class information
         string name () const {return m_name;}
         string folder () const {return m_folder;}
@@ -96,6 +159,16 @@ class PROT::PDB {
         Structure * structure (const size_t);
         bool obsolete () const {return m_obsolete;}
         bool theoretical () const {return m_theoretical;}
+        bool mmcif () const {return m_mmcif;}
+        // The name of the chain a Protein was loaded from
+        string chain (const char) const;
+        // The number of models in the file, and moving the Atoms of the
+        // Proteins to the coordinates of one of them (the first is model 0).
+        // A model with different Atoms than the first one gets Proteins made
+        // from its own Atoms instead
+        size_t models () const {
+            return (m_models.size() > 0) ? m_models.size() : 1;}
+        void load_model (const size_t);
         // A string representation of the PDB file's information
         string str () const;
         // set the elements of the atoms in the PDB file
@@ -110,7 +183,10 @@ class PROT::PDB {
 
 // Include the PDB header files
 #include "PDB/copy.h"
+#include "PDB/mmcif.h"
 #include "PDB/load.h"
+#include "PDB/models.h"
+#include "PDB/cache.h"
 #include "PDB/identify.h"
 #include "PDB/file_status.h"
 #include "PDB/residues.h"
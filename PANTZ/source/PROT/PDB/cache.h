@@ -0,0 +1,319 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file is intended to be included by the PDB.h header file. It implements
+ * the methods of the PDB class that keep what was loaded from a file in a
+ * binary cache file in the PANTZ_CACHE_PATH folder. The cache stores the
+ * file's header records, the information of its Atoms and the coordinates or
+ * Atoms of its models in fixed-width arrays, along with a hash of the file's
+ * contents. Loading a file whose contents still have that hash copies the
+ * arrays out of the mapped cache instead of reading and checking the text
+ * again. */
+
+// Confirm that the PDB class is loading the content
+#ifndef PDB_Loading_Status
+#error PDB methods must be included by PDB.h
+#endif
+
+// The start of a cache file. Its sections follow it in the order they are
+// written by save_cache, each padded to a multiple of 8 bytes
+struct PDBCacheHeader {
+    char magic [8];
+    // The version of the format and a value that shows the byte order
+    uint32_t version;
+    uint32_t order;
+    // The size and hash of the file the cache was made from
+    uint64_t source_size;
+    uint64_t source_hash;
+    // The number of lines, names and Atoms and the sizes of their text. The
+    // Atoms of the models that are different from the first one are counted
+    uint64_t lines;
+    uint64_t line_text;
+    uint64_t names;
+    uint64_t name_text;
+    uint64_t atoms;
+    uint64_t models;
+    // The number of chains with longer names and the size of their names
+    uint64_t chains;
+    uint64_t chain_text;
+    // The information that mmCIF files store outside of their lines
+    uint64_t type_size;
+    double resolution;
+    uint8_t mmcif;
+    uint8_t obsolete;
+    uint8_t theoretical;
+    uint8_t padding [5];
+};
+
+const char PDBCacheMagic [8] = {'P', 'A', 'N', 'T', 'Z', 'P', 'D', 'B'};
+const uint32_t PDBCacheVersion = 6;
+const uint32_t PDBCacheOrder = 0x01020304;
+
+// Add an array of values to a cache that is being written
+template<class T>
+void PDBCacheWrite (vector<char>& data, const T * values, const size_t count) {
+    const char * bytes = reinterpret_cast<const char *>(values);
+    data.insert(data.end(), bytes, bytes + count * sizeof(T));
+    data.resize((data.size() + 7) & ~size_t(7), 0);
+}
+
+// Reads the sections of a cache, making sure that they are all there
+struct PDBCacheReader {
+    const char * data;
+    size_t size;
+    size_t at;
+    bool ok;
+    PDBCacheReader (const char * d, const size_t s) :
+        data (d), size (s), at (0), ok (true) {}
+    template<class T>
+    const T * take (const uint64_t count) {
+        if ((!ok) || (count > (size - at) / sizeof(T))) {ok = false; return 0;}
+        const T * values = reinterpret_cast<const T *>(data + at);
+        at = (at + count * sizeof(T) + 7) & ~size_t(7);
+        if (at > size) {ok = false; at = size;}
+        return values;}
+};
+
+// The caches are kept in the PANTZ_CACHE_PATH folder and named by the size and
+// hash of the contents they were made from, so files with the same contents
+// share a cache
+string PROT::PDB::cache_name (const uint64_t hash, const size_t size) {
+    string folder = PANTZ_CACHE_PATH;
+    if ((folder.size() > 0) && (folder[folder.size()-1] != '/')) {folder += "/";}
+    stringstream c; c << hex << setfill('0') << setw(16) << hash << dec
+                      << "_" << size << ".snapshot";
+    return folder + c.str();
+}
+
+// Load the information from a cache if it was made from a file with the same
+// contents, returning whether or not that was possible
+bool PROT::PDB::load_cache (const string& cache, const uint64_t hash,
+                            const size_t size) {
+    MappedFile file;
+    if (!file.open(cache)) {return false;}
+    // Make sure the cache matches the file and has all of its sections
+    PDBCacheReader reader (file.data(), file.size());
+    const PDBCacheHeader * header = reader.take<PDBCacheHeader>(1);
+    if ((!reader.ok) || (memcmp(header->magic, PDBCacheMagic, 8) != 0) ||
+        (header->version != PDBCacheVersion) ||
+        (header->order != PDBCacheOrder) || (header->source_size != size) ||
+        (header->source_hash != hash)) {return false;}
+    const uint64_t N = header->atoms;
+    if (N > file.size()) {return false;}
+    const char * type = reader.take<char>(header->type_size);
+    const uint64_t * line_starts = reader.take<uint64_t>(header->lines + 1);
+    const char * line_text = reader.take<char>(header->line_text);
+    const uint64_t * name_starts = reader.take<uint64_t>(header->names + 1);
+    const char * name_text = reader.take<char>(header->name_text);
+    const coor * coordinates = reader.take<coor>(3 * N);
+    const float * occupancies = reader.take<float>(N);
+    const float * temperatures = reader.take<float>(N);
+    const int64_t * numbers = reader.take<int64_t>(N);
+    const int64_t * residue_numbers = reader.take<int64_t>(N);
+    const uint32_t * names = reader.take<uint32_t>(4 * N);
+    const uint8_t * characters = reader.take<uint8_t>(4 * N);
+    // The first model's Atoms are followed by those of each model that is
+    // different from it
+    const uint64_t * sizes = reader.take<uint64_t>(header->models);
+    if (!reader.ok) {return false;}
+    uint64_t first = N;
+    for(uint64_t m=0; m<header->models; ++m) {
+        if (sizes[m] > first) {return false;}
+        first -= sizes[m];}
+    const coor * models = 0;
+    if ((header->models == 0) || (first <= (uint64_t(-1) / 3) / header->models)) {
+        models = reader.take<coor>(header->models * 3 * first);}
+    const uint8_t * matched = reader.take<uint8_t>(header->models);
+    const char * chain_names = reader.take<char>(header->chains);
+    const uint64_t * chain_starts = reader.take<uint64_t>(header->chains + 1);
+    const char * chain_text = reader.take<char>(header->chain_text);
+    if ((!reader.ok) || (models == 0)) {return false;}
+    for(uint64_t i=0; i<header->chains; ++i) {
+        if ((chain_starts[i] > chain_starts[i+1]) ||
+            (chain_starts[i+1] > header->chain_text)) {return false;}}
+    for(uint64_t i=0; i<header->lines; ++i) {
+        if ((line_starts[i] > line_starts[i+1]) ||
+            (line_starts[i+1] > header->line_text)) {return false;}}
+    for(uint64_t i=0; i<header->names; ++i) {
+        if ((name_starts[i] > name_starts[i+1]) ||
+            (name_starts[i+1] > header->name_text)) {return false;}}
+    for(uint64_t i=0; i<4*N; ++i) {
+        if (names[i] >= header->names) {return false;}}
+    for(uint64_t i=0; i<N; ++i) {
+        if (characters[3*N + i] >= 128) {return false;}}
+    // Store the information that is not in the lines
+    m_mmcif = header->mmcif;
+    m_type.assign(type, header->type_size);
+    m_resolution = header->resolution;
+    m_obsolete = header->obsolete;
+    m_theoretical = header->theoretical;
+    m_chains.clear();
+    for(uint64_t i=0; i<header->chains; ++i) {
+        m_chains[chain_names[i]] = string(chain_text + chain_starts[i],
+                                          chain_starts[i+1] - chain_starts[i]);}
+    // Store the header records
+    m_lines.clear(); m_lines.reserve(header->lines);
+    for(uint64_t i=0; i<header->lines; ++i) {
+        m_lines.push_back(string(line_text + line_starts[i],
+                                 line_starts[i+1] - line_starts[i]));}
+    // Intern the names once, then make the Atoms
+    vector<Names::ID> ids; ids.reserve(header->names);
+    for(uint64_t i=0; i<header->names; ++i) {
+        ids.push_back(Names::intern(string(name_text + name_starts[i],
+                                           name_starts[i+1] - name_starts[i])));}
+    m_atoms.clear(); m_atoms.resize(128);
+    m_topology.clear(); m_models.clear(); m_model_atoms.clear();
+    m_model_atoms.resize(header->models);
+    uint64_t end = first;
+    size_t model = 0;
+    for(uint64_t i=0; i<N; ++i) {
+        while (i == end) {end += sizes[model]; ++model;}
+        Atom atom;
+        for(size_t j=0; j<3; ++j) {atom.m_coors[j] = coordinates[3*i + j];}
+        atom.m_occupancy = occupancies[i];
+        atom.m_temperature = temperatures[i];
+        atom.m_number = numbers[i];
+        atom.m_residue_number = residue_numbers[i];
+        atom.m_name = ids[names[i]];
+        atom.m_residue = ids[names[N + i]];
+        atom.m_element = ids[names[2*N + i]];
+        atom.m_charge = ids[names[3*N + i]];
+        atom.m_hetatm = characters[i];
+        atom.m_alt = characters[N + i];
+        atom.m_insertion = characters[2*N + i];
+        atom.m_protein = characters[3*N + i];
+        atom.classify();
+        if (model > 0) {
+            m_model_atoms[model - 1].push_back(std::move(atom));
+            continue;}
+        if (header->models > 0) {m_topology.push_back(model_atom(atom));}
+        m_atoms[(int) atom.m_protein].push_back(std::move(atom));}
+    // Store the coordinates of the models that have the same Atoms as the
+    // first one
+    for(uint64_t m=0; m<header->models; ++m) {
+        if (matched[m]) {
+            m_models.push_back(vector<coor>(models + m * 3 * first,
+                                            models + (m + 1) * 3 * first));}
+        else {m_models.push_back(vector<coor>());}}
+    return true;
+}
+
+// Save the information that was loaded from a file in a cache. The cache is
+// only an optimization, so if it can't be written nothing else happens
+void PROT::PDB::save_cache (const string& cache, const uint64_t hash,
+                            const size_t size) const {
+    // Collect the header records
+    vector<uint64_t> line_starts (1, 0);
+    string line_text;
+    for(size_t i=0; i<m_lines.size(); ++i) {
+        line_text += m_lines[i];
+        line_starts.push_back(line_text.size());}
+    // Collect the Atoms, listing each of their names once. The first model's
+    // Atoms are followed by those of the models that are different from it
+    vector<const Atom *> atoms;
+    for(size_t i=0; i<m_atoms.size(); ++i) {
+        for(size_t j=0; j<m_atoms[i].size(); ++j) {
+            atoms.push_back(&(m_atoms[i][j]));}}
+    const size_t first = atoms.size();
+    vector<uint64_t> sizes (m_models.size(), 0);
+    for(size_t m=0; m<m_model_atoms.size(); ++m) {
+        sizes[m] = m_model_atoms[m].size();
+        for(size_t i=0; i<m_model_atoms[m].size(); ++i) {
+            atoms.push_back(&(m_model_atoms[m][i]));}}
+    const size_t N = atoms.size();
+    unordered_map<Names::ID, uint32_t> listed;
+    vector<uint64_t> name_starts (1, 0);
+    string name_text;
+    vector<coor> coordinates (3 * N);
+    vector<float> occupancies (N), temperatures (N);
+    vector<int64_t> numbers (N), residue_numbers (N);
+    vector<uint32_t> names (4 * N);
+    vector<uint8_t> characters (4 * N);
+    for(size_t i=0; i<N; ++i) {
+        const Atom * atom = atoms[i];
+        for(size_t j=0; j<3; ++j) {coordinates[3*i + j] = atom->m_coors[j];}
+        occupancies[i] = atom->m_occupancy;
+        temperatures[i] = atom->m_temperature;
+        numbers[i] = atom->m_number;
+        residue_numbers[i] = atom->m_residue_number;
+        const Names::ID ids [4] = {atom->m_name, atom->m_residue,
+                                   atom->m_element, atom->m_charge};
+        for(size_t j=0; j<4; ++j) {
+            unordered_map<Names::ID, uint32_t>::iterator it = listed.find(ids[j]);
+            if (it == listed.end()) {
+                it = listed.insert(make_pair(ids[j], (uint32_t) listed.size())).first;
+                name_text += Names::text(ids[j]);
+                name_starts.push_back(name_text.size());}
+            names[j*N + i] = it->second;}
+        characters[i] = atom->m_hetatm;
+        characters[N + i] = atom->m_alt;
+        characters[2*N + i] = atom->m_insertion;
+        characters[3*N + i] = atom->m_protein;}
+    // Collect the names of the chains
+    string chain_names, chain_text;
+    vector<uint64_t> chain_starts (1, 0);
+    for(map<char, string>::const_iterator it = m_chains.begin();
+        it != m_chains.end(); ++it) {
+        chain_names += it->first;
+        chain_text += it->second;
+        chain_starts.push_back(chain_text.size());}
+    // Assemble the cache
+    PDBCacheHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, PDBCacheMagic, 8);
+    header.version = PDBCacheVersion;
+    header.order = PDBCacheOrder;
+    header.source_size = size;
+    header.source_hash = hash;
+    header.lines = m_lines.size();
+    header.line_text = line_text.size();
+    header.names = listed.size();
+    header.name_text = name_text.size();
+    header.atoms = N;
+    header.models = m_models.size();
+    header.chains = m_chains.size();
+    header.chain_text = chain_text.size();
+    header.type_size = m_type.size();
+    header.resolution = m_resolution;
+    header.mmcif = m_mmcif;
+    header.obsolete = m_obsolete;
+    header.theoretical = m_theoretical;
+    vector<char> data;
+    PDBCacheWrite(data, &header, 1);
+    PDBCacheWrite(data, m_type.data(), m_type.size());
+    PDBCacheWrite(data, line_starts.data(), line_starts.size());
+    PDBCacheWrite(data, line_text.data(), line_text.size());
+    PDBCacheWrite(data, name_starts.data(), name_starts.size());
+    PDBCacheWrite(data, name_text.data(), name_text.size());
+    PDBCacheWrite(data, coordinates.data(), coordinates.size());
+    PDBCacheWrite(data, occupancies.data(), N);
+    PDBCacheWrite(data, temperatures.data(), N);
+    PDBCacheWrite(data, numbers.data(), N);
+    PDBCacheWrite(data, residue_numbers.data(), N);
+    PDBCacheWrite(data, names.data(), names.size());
+    PDBCacheWrite(data, characters.data(), characters.size());
+    PDBCacheWrite(data, sizes.data(), sizes.size());
+    // The coordinates of the models are a single section. A model without
+    // coordinates is written as zeros
+    vector<coor> models (m_models.size() * 3 * first, 0);
+    vector<uint8_t> matched (m_models.size(), 0);
+    for(size_t m=0; m<m_models.size(); ++m) {
+        if (m_models[m].size() != 3 * first) {continue;}
+        std::copy(m_models[m].begin(), m_models[m].end(), models.begin() + m * 3 * first);
+        matched[m] = 1;}
+    PDBCacheWrite(data, models.data(), models.size());
+    PDBCacheWrite(data, matched.data(), matched.size());
+    PDBCacheWrite(data, chain_names.data(), chain_names.size());
+    PDBCacheWrite(data, chain_starts.data(), chain_starts.size());
+    PDBCacheWrite(data, chain_text.data(), chain_text.size());
+    // Write it to a temporary file and then put that in place, so that a
+    // partly written cache is never used
+    mkdir(cache.substr(0, cache.rfind('/')).c_str(), 0777);
+    stringstream c; c << cache << "." << getpid() << "." << this;
+    const string temporary = c.str();
+    ofstream output (temporary.c_str(), ios::binary);
+    if (!output.is_open()) {return;}
+    output.write(data.data(), data.size());
+    output.close();
+    if ((!output) || (rename(temporary.c_str(), cache.c_str()) != 0)) {
+        remove(temporary.c_str());}
+}
@@ -19,11 +19,14 @@ PROT::PDB::PDB (const string& fileName, const string path = "") {
     // Use a try statement to add to any error that comes up in the subsequent
     // steps
     try {
-        identify_type();
-        check_file_status();
-        if (m_obsolete) {return;}
-        identify_resolution ();
+        // The header information of mmCIF files is read when they are loaded
+        if (!m_mmcif) {
+            identify_type();
+            check_file_status();
+            if (m_obsolete) {m_atoms.clear(); return;}
+            identify_resolution ();}
         construct_Proteins ();
+        place_models ();
         create_Structures ();
         }
     catch (PANTZ_error& e) {
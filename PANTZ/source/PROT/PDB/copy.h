@@ -1,7 +1,8 @@
 /* Created by the Pantazes Lab at Auburn University.
  *
  * This file is intended to be included by the PDB.h header file. It implements
- * the copy method of the PDB class. */
+ * the copy method of the PDB class and the take method that moves the
+ * information out of another PDB. */
 
 // Confirm that the PDB class is loading the content
 #ifndef PDB_Loading_Status
@@ -17,6 +18,14 @@ void PROT::PDB::copy (const PDB * other) {
     m_resolution = other->m_resolution;
     m_obsolete = other->m_obsolete;
     m_theoretical = other->m_theoretical;
+    m_mmcif = other->m_mmcif;
+    m_chains = other->m_chains;
+    // Copy the models
+    m_topology = other->m_topology;
+    m_models = other->m_models;
+    m_model_atoms = other->m_model_atoms;
+    m_first_model = other->m_first_model;
+    m_places = other->m_places;
     // Copy the lines vector
     m_lines.clear(); m_lines.reserve(other->m_lines.size());
     if (other->m_lines.size() > 0) {
@@ -34,3 +43,28 @@ void PROT::PDB::copy (const PDB * other) {
         for(size_t i=0; i<other->m_structures.size(); ++i) {
             m_structures.push_back(Structure(other->m_structures[i], m_proteins));}}
 }
+
+// Take the information from a PDB that is about to be destroyed. Moving the
+// vector of Proteins does not move the Proteins in memory, so the Structures'
+// pointers to them stay valid
+void PROT::PDB::take (PDB& other) {
+    m_name = std::move(other.m_name);
+    m_folder = std::move(other.m_folder);
+    m_type = std::move(other.m_type);
+    m_resolution = other.m_resolution;
+    m_obsolete = other.m_obsolete;
+    m_theoretical = other.m_theoretical;
+    m_mmcif = other.m_mmcif;
+    m_chains = std::move(other.m_chains);
+    m_lines = std::move(other.m_lines);
+    m_topology = std::move(other.m_topology);
+    m_models = std::move(other.m_models);
+    m_model_atoms = std::move(other.m_model_atoms);
+    m_first_model = std::move(other.m_first_model);
+    m_places = std::move(other.m_places);
+    m_proteins = std::move(other.m_proteins);
+    m_structures = std::move(other.m_structures);
+    other.m_lines.clear();
+    other.m_proteins.clear();
+    other.m_structures.clear();
+}
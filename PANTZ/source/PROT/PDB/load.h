@@ -1,7 +1,9 @@
 /* Created by the Pantazes Lab at Auburn University.
  *
  * This file is intended to be included by the PDB.h header file. It implements
- * the load method of the PDB class. */
+ * the load methods of the PDB class. The file is read in a single pass, and
+ * the Atoms are read from their lines as those are found. Only the other
+ * lines, which are the header records, are stored. */
 
 // Confirm that the PDB class is loading the content
 #ifndef PDB_Loading_Status
@@ -13,42 +15,99 @@ void PROT::PDB::load () {
     // Assemble the name of the file 
     string fileName = m_folder + m_name;
     // Attempt to open that file
-    ifstream input; input.open(fileName.c_str());
+    MappedFile input;
     // If the file is not open, throw an error
-    if(!input.is_open()) {
+    if(!input.open(fileName)) {
         string error = "Failure to open:\nFile: " + m_name + "\nLocation: ";
         if ((m_folder == "./") || (m_folder == "")) {
             error += "Current Folder\n";}
         else {error += m_folder + "\n";}
         throw PANTZ_error (error);}
-    // The lines will be stored here
-    string line;
-    // For NMR files, only lines containing the first model will be loaded
-    bool model_flag = false;
-    // Go through the file's lines
-    getline(input, line);
-    while(!input.eof()) {
+    const char * text = input.data();
+    const size_t size = input.size();
+    // If a cache folder is set and the file has been loaded before, use what
+    // was loaded then
+    string cache;
+    uint64_t hash = 0;
+    if (string(PANTZ_CACHE_PATH).size() > 0) {
+        hash = input.hash();
+        cache = cache_name(hash, size);
+        if (load_cache(cache, hash, size)) {return;}}
+    // mmCIF files are loaded differently
+    if (MMCIFText(text, size)) {load_mmcif(text, size);}
+    else {load_pdb(text, size);}
+    input.close();
+    // Save what was loaded for the next time
+    if (cache.size() > 0) {save_cache(cache, hash, size);}
+}
+
+// Whether or not a line of a PDB file is a particular type of record
+bool PDBRecord (const char * line, const size_t size, const char * record) {
+    const size_t length = strlen(record);
+    return ((size >= length) && (memcmp(line, record, length) == 0));
+}
+
+// Load the contents of a PDB file from its text
+void PROT::PDB::load_pdb (const char * text, const size_t size) {
+    // The experiment information is identified from the lines later
+    m_mmcif = false;
+    m_chains.clear();
+    m_type = "UNKNOWN";
+    m_resolution = -1.0;
+    m_obsolete = false;
+    m_theoretical = false;
+    m_lines.clear();
+    m_atoms.clear(); m_atoms.resize(128);
+    // For NMR files, only lines containing the first model will be loaded.
+    // The Atoms of the other models are kept separately. The
+    // first MODEL record starts the first model, whatever its serial number,
+    // and the others are kept in the order they appear in the file
+    bool model_flag = false, model_seen = false;
+    vector<vector<Atom> > models;
+    // Go through the file's lines. Only lines that are ended by a new line
+    // character are used
+    size_t next = 0, count = 0;
+    while (true) {
+        // Find the end of the line
+        const size_t start = next;
+        const char * end = static_cast<const char *>(memchr(text + start,
+                                                            '\n', size - start));
+        if (end == 0) {break;}
+        next = (end - text) + 1;
+        ++count;
         // Strip whitespace from the line
-        Text::strip(line);
+        size_t first = start, last = end - text;
+        while ((first < last) && (Text::is_whitespace(text[first]))) {++first;}
+        while ((last > first) && (Text::is_whitespace(text[last-1]))) {--last;}
+        const char * line = text + first;
+        const size_t length = last - first;
         // If the line starts with the word "model"
-        if (Text::startswith(line, "MODEL")) {
-            // Split the line into pieces
-            vector<string> parts = Text::split(line);
-            // If there are at least two pieces and the second piece is not
-            // "1", set the flag to true. If it is 1, set the flag to false
-            if (parts.size() > 1) {
-                if (parts[1] == "1") {model_flag = false;}
-                else {model_flag = true;}}}
-        // If the line should be stored, do so
-        if(!model_flag) {m_lines.push_back(line);}
-        // Get the next line
-        getline(input, line);}
-    // Close the input file
-    input.close();
+        if (PDBRecord(line, length, "MODEL")) {
+            if (!model_seen) {model_seen = true; model_flag = false;}
+            else {model_flag = true; models.push_back(vector<Atom>());}}
+        // If the line is an Atom, read it. If the Atom's alternative location
+        // characteristic is 'A' or ' ', store it with the Atoms of its
+        // Protein, or with its model if it is not in the first one
+        if ((PDBRecord(line, length, "ATOM")) ||
+            (PDBRecord(line, length, "HETATM"))) {
+            Atom atom;
+            if (atom.read(line, length)) {
+                if (atom.m_alt == 'A') {atom.m_alt = ' ';}
+                if (atom.m_alt != ' ') {continue;}
+                if (model_flag) {models.back().push_back(std::move(atom));}
+                else {m_atoms[(int) atom.protein()].push_back(std::move(atom));}}
+            continue;}
+        // The lines of the models after the first one are not stored
+        if (model_flag) {continue;}
+        // Store the header record
+        m_lines.push_back(string(line, length));}
     // If no contents were identified, raise an error
-    if (m_lines.size() == 0) {
+    if (count == 0) {
         string error = "No contents were identified in:\nFile: " + m_name
                      + "\nLocation: " + m_folder + "\n";
         throw PANTZ_error (error);}
+    // Line the other models up with the first one
+    m_topology.clear(); m_models.clear(); m_model_atoms.clear();
+    if (models.size() > 0) {collect_models(models);}
     // End this function
 }
@@ -0,0 +1,327 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file is intended to be included by the PDB.h header file. It implements
+ * the method of the PDB class that loads an mmCIF file. The Atoms are read from
+ * the _atom_site values as the file's text is split into them, so the file is
+ * read in a single pass and none of its lines are stored. The experiment type
+ * and resolution are read from the _exptl, _refine, _reflns and
+ * _em_3d_reconstruction values. Proteins are named by a single character, so
+ * chains with longer names are loaded as Proteins named by characters that no
+ * other chain uses. */
+
+// Confirm that the PDB class is loading the content
+#ifndef PDB_Loading_Status
+#error PDB methods must be included by PDB.h
+#endif
+
+// A value in an mmCIF file, which stays in place in the file's text
+struct MMCIFToken {
+    const char * text;
+    size_t size;
+    // Whether or not the value was quoted, in which case it can't be a tag or
+    // a keyword
+    bool quoted;
+    MMCIFToken () : text (""), size (0), quoted (false) {}
+};
+
+// Splits the text of an mmCIF file into its values
+class MMCIFTokens {
+    private:
+        const char * m_text;
+        size_t m_size;
+        size_t m_at;
+        static bool is_space (const char c) {
+            return ((c == ' ') || (c == '\t') || (c == '\r') || (c == '\n'));}
+    public:
+        MMCIFTokens (const char * text, const size_t size) :
+            m_text (text), m_size (size), m_at (0) {}
+        // Get the next value, returning false at the end of the text
+        bool next (MMCIFToken&);
+};
+
+bool MMCIFTokens::next (MMCIFToken& token) {
+    while (true) {
+        while ((m_at < m_size) && (is_space(m_text[m_at]))) {++m_at;}
+        if (m_at >= m_size) {return false;}
+        // Comments continue to the end of the line
+        if (m_text[m_at] != '#') {break;}
+        while ((m_at < m_size) && (m_text[m_at] != '\n')) {++m_at;}}
+    const char c = m_text[m_at];
+    // A semicolon at the start of a line starts a text field, which ends at
+    // the next line that starts with a semicolon
+    if ((c == ';') && ((m_at == 0) || (m_text[m_at-1] == '\n'))) {
+        size_t start = m_at + 1, end = start;
+        while ((end < m_size) && (!((m_text[end] == ';') &&
+                                    (m_text[end-1] == '\n')))) {++end;}
+        token.text = m_text + start;
+        token.size = (end > start) ? end - start - 1 : 0;
+        token.quoted = true;
+        m_at = end + 1;
+        return true;}
+    // Quoted values end at a matching quote that is followed by whitespace
+    if ((c == '\'') || (c == '"')) {
+        size_t start = m_at + 1, end = start;
+        while ((end < m_size) && (m_text[end] != '\n') &&
+               (!((m_text[end] == c) && ((end + 1 == m_size) ||
+                                         (is_space(m_text[end+1])))))) {++end;}
+        token.text = m_text + start;
+        token.size = end - start;
+        token.quoted = true;
+        m_at = end + 1;
+        return true;}
+    // Anything else ends at whitespace
+    size_t start = m_at;
+    while ((m_at < m_size) && (!is_space(m_text[m_at]))) {++m_at;}
+    token.text = m_text + start;
+    token.size = m_at - start;
+    token.quoted = false;
+    return true;
+}
+
+// Whether or not a value starts with a phrase, ignoring the case of its letters
+bool MMCIFStarts (const MMCIFToken& token, const char * phrase) {
+    size_t n = strlen(phrase);
+    if ((token.quoted) || (token.size < n)) {return false;}
+    for(size_t i=0; i<n; ++i) {
+        char c = token.text[i];
+        if (Text::is_upper(c)) {c += 32;}
+        if (c != phrase[i]) {return false;}}
+    return true;
+}
+
+// Whether or not a value is a phrase, ignoring the case of its letters
+bool MMCIFIs (const MMCIFToken& token, const char * phrase) {
+    return ((token.size == strlen(phrase)) && (MMCIFStarts(token, phrase)));
+}
+
+// Whether or not a value ends the values of a loop
+bool MMCIFEndsLoop (const MMCIFToken& token) {
+    return ((MMCIFStarts(token, "_")) || (MMCIFIs(token, "loop_")) ||
+            (MMCIFStarts(token, "data_")) || (MMCIFStarts(token, "save_")) ||
+            (MMCIFIs(token, "global_")) || (MMCIFIs(token, "stop_")));
+}
+
+// Whether or not text is an mmCIF file, which starts with a data block
+// (possibly after some comments)
+bool MMCIFText (const char * text, const size_t size) {
+    MMCIFTokens tokens (text, size);
+    MMCIFToken token;
+    return ((tokens.next(token)) && (MMCIFStarts(token, "data_")));
+}
+
+// The tags of the _atom_site values that Atoms are read from, in the order of
+// the Atom's SiteValues. Where there are two, the first is what PDB files
+// contain and the second is used if the first is missing
+const char * const MMCIFSiteTags [PROT::Atom::SiteValues][2] = {
+    {"_atom_site.group_pdb", 0},
+    {"_atom_site.id", 0},
+    {"_atom_site.type_symbol", 0},
+    {"_atom_site.auth_atom_id", "_atom_site.label_atom_id"},
+    {"_atom_site.label_alt_id", 0},
+    {"_atom_site.auth_comp_id", "_atom_site.label_comp_id"},
+    {"_atom_site.auth_asym_id", "_atom_site.label_asym_id"},
+    {"_atom_site.auth_seq_id", "_atom_site.label_seq_id"},
+    {"_atom_site.pdbx_pdb_ins_code", 0},
+    {"_atom_site.cartn_x", 0},
+    {"_atom_site.cartn_y", 0},
+    {"_atom_site.cartn_z", 0},
+    {"_atom_site.occupancy", 0},
+    {"_atom_site.b_iso_or_equiv", 0},
+    {"_atom_site.pdbx_formal_charge", 0},
+    {"_atom_site.pdbx_pdb_model_num", 0}};
+
+// The other values that are used, and the tags of the resolution in the order
+// they are preferred
+const char * const MMCIFMethodTag = "_exptl.method";
+const size_t MMCIFResolutions = 3;
+const char * const MMCIFResolutionTags [MMCIFResolutions] = {
+    "_refine.ls_d_res_high", "_em_3d_reconstruction.resolution",
+    "_reflns.d_resolution_high"};
+
+// The characters that chains with longer names are given as Protein names, in
+// the order they are used
+const char * const MMCIFProteinNames = "ABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+
+// An Atom of a chain with a longer name, which is given its Protein name once
+// every chain's name is known. Its model is 0 for the first model, and the
+// index is of the Atom in the first model's or in its model's Atoms
+struct MMCIFRenamed {
+    size_t chain;
+    size_t model;
+    size_t index;
+};
+
+// Load the contents of an mmCIF file. Only the first data block is used
+void PROT::PDB::load_mmcif (const char * text, const size_t size) {
+    m_mmcif = true;
+    m_chains.clear();
+    m_type = "UNKNOWN";
+    m_resolution = -1.0;
+    m_obsolete = false;
+    m_atoms.clear(); m_atoms.resize(128);
+    // The values of the current _atom_site row, and the first model number,
+    // since only the Atoms of the first model are used to make the Proteins
+    // (like the first MODEL of PDB files). The other models' Atoms are kept
+    // separately
+    vector<string> site (Atom::SiteValues);
+    string model, later_model;
+    bool model_seen = false;
+    vector<vector<Atom> > models;
+    // The chains with longer names, in the order they are found, and the Atoms
+    // that are in them
+    vector<string> chains;
+    map<string, size_t> chain_index;
+    vector<MMCIFRenamed> renamed;
+    vector<Atom> renamed_atoms;
+    // The best resolution value seen so far
+    size_t resolution = MMCIFResolutions;
+    // Every value is part of a loop. A tag that is not in a loop_ is a loop
+    // with a single row
+    MMCIFTokens tokens (text, size);
+    MMCIFToken token;
+    bool have = tokens.next(token);
+    size_t blocks = 0;
+    vector<MMCIFToken> tags, row;
+    while (have) {
+        // Data blocks
+        if (MMCIFStarts(token, "data_")) {
+            if (++blocks > 1) {break;}
+            have = tokens.next(token); continue;}
+        // Collect the tags of the loop
+        tags.clear();
+        if (MMCIFIs(token, "loop_")) {
+            while ((have = tokens.next(token)) && (MMCIFStarts(token, "_"))) {
+                tags.push_back(token);}}
+        else if (MMCIFStarts(token, "_")) {
+            tags.push_back(token);
+            have = tokens.next(token);}
+        else {have = tokens.next(token); continue;}
+        // Work out what each of the tags is used for
+        vector<int> site_columns (2 * Atom::SiteValues, -1);
+        int method = -1, resolution_column = -1;
+        size_t resolution_rank = MMCIFResolutions;
+        bool atoms = false;
+        for(size_t i=0; i<tags.size(); ++i) {
+            for(size_t v=0; v<Atom::SiteValues; ++v) {
+                for(size_t k=0; k<2; ++k) {
+                    if ((MMCIFSiteTags[v][k] != 0) &&
+                        (MMCIFIs(tags[i], MMCIFSiteTags[v][k]))) {
+                        site_columns[2*v + k] = i; atoms = true;}}}
+            if (MMCIFIs(tags[i], MMCIFMethodTag)) {method = i;}
+            for(size_t r=0; r<MMCIFResolutions; ++r) {
+                if ((r < resolution_rank) && (r < resolution) &&
+                    (MMCIFIs(tags[i], MMCIFResolutionTags[r]))) {
+                    resolution_column = i; resolution_rank = r;}}}
+        // Go through the rows of values
+        row.resize(tags.size());
+        size_t column = 0, rows = 0;
+        while ((have) && (!MMCIFEndsLoop(token))) {
+            row[column] = token;
+            have = tokens.next(token);
+            if (++column < tags.size()) {continue;}
+            column = 0; ++rows;
+            // The experiment type. If there are several, they are listed
+            // together
+            if (method >= 0) {
+                string value (row[method].text, row[method].size);
+                Text::strip(value); Text::upper(value);
+                if (rows == 1) {m_type = value;}
+                else {m_type += "; " + value;}}
+            // The resolution
+            if ((resolution_column >= 0) && (rows == 1)) {
+                string value (row[resolution_column].text,
+                              row[resolution_column].size);
+                if (Text::is_number(value)) {
+                    m_resolution = strtod(value.c_str(), 0);
+                    resolution = resolution_rank;}}
+            if (!atoms) {continue;}
+            // The values of the Atom. The null values '.' and '?' are missing
+            for(size_t v=0; v<Atom::SiteValues; ++v) {
+                site[v].clear();
+                for(size_t k=0; k<2; ++k) {
+                    int c = site_columns[2*v + k];
+                    if (c < 0) {continue;}
+                    const MMCIFToken& value = row[c];
+                    if ((!value.quoted) && (value.size == 1) &&
+                        ((value.text[0] == '.') || (value.text[0] == '?'))) {
+                        continue;}
+                    site[v].assign(value.text, value.size);
+                    break;}}
+            // Work out which model the Atom is in
+            if (!model_seen) {model = site[Atom::SiteModel]; model_seen = true;}
+            const bool later = (site[Atom::SiteModel] != model);
+            if ((later) && ((models.size() == 0) ||
+                            (site[Atom::SiteModel] != later_model))) {
+                later_model = site[Atom::SiteModel];
+                models.push_back(vector<Atom>());}
+            // Atoms are sorted into Proteins by a single character. A chain
+            // with a longer name is read as a blank name for now
+            string chain;
+            if (site[Atom::SiteProtein].size() > 1) {
+                chain.swap(site[Atom::SiteProtein]);
+                site[Atom::SiteProtein] = " ";}
+            // Read the Atom and store it if its alternative location
+            // characteristic is 'A' or ' '
+            Atom atom;
+            if (!atom.read(site)) {continue;}
+            if (atom.m_alt == 'A') {atom.m_alt = ' ';}
+            if (atom.m_alt != ' ') {continue;}
+            if (chain.size() > 0) {
+                map<string, size_t>::iterator it = chain_index.find(chain);
+                if (it == chain_index.end()) {
+                    it = chain_index.insert(make_pair(chain, chains.size())).first;
+                    chains.push_back(chain);}
+                MMCIFRenamed listed;
+                listed.chain = it->second;
+                listed.model = (later) ? models.size() : 0;
+                listed.index = (later) ? models.back().size()
+                                       : renamed_atoms.size();
+                renamed.push_back(listed);
+                if (later) {models.back().push_back(std::move(atom));}
+                else {renamed_atoms.push_back(std::move(atom));}}
+            else if (later) {models.back().push_back(std::move(atom));}
+            else {m_atoms[(int) atom.protein()].push_back(std::move(atom));}}}
+    // Give the chains with longer names the Protein names that no other chain
+    // uses
+    if (chains.size() > 0) {
+        vector<bool> used (128, false);
+        for(size_t i=0; i<m_atoms.size(); ++i) {
+            used[i] = (m_atoms[i].size() > 0);}
+        for(size_t m=0; m<models.size(); ++m) {
+            for(size_t i=0; i<models[m].size(); ++i) {
+                used[(int) models[m][i].m_protein] = true;}}
+        vector<char> names;
+        for(const char * c = MMCIFProteinNames; *c != '\0'; ++c) {
+            if (!used[(int) *c]) {names.push_back(*c);}}
+        if (names.size() < chains.size()) {
+            stringstream c1; c1 << chains.size();
+            stringstream c2; c2 << names.size();
+            string error = "The file has " + c1.str() + " chains with names "
+                           "longer than a single character, but its other "
+                           "chains only leave " + c2.str() + " single "
+                           "character Protein names for them.\n";
+            throw PANTZ_error (error);}
+        for(size_t i=0; i<chains.size(); ++i) {m_chains[names[i]] = chains[i];}
+        for(size_t i=0; i<renamed.size(); ++i) {
+            const MMCIFRenamed& listed = renamed[i];
+            const char name = names[listed.chain];
+            if (listed.model > 0) {
+                models[listed.model - 1][listed.index].m_protein = name;}
+            else {
+                Atom& atom = renamed_atoms[listed.index];
+                atom.m_protein = name;
+                m_atoms[(int) name].push_back(std::move(atom));}}}
+    // Identify whether or not the structure is theoretical
+    m_theoretical = Text::contains(m_type, "THEORETICAL");
+    // Line the other models up with the first one
+    m_topology.clear(); m_models.clear(); m_model_atoms.clear();
+    if (models.size() > 0) {collect_models(models);}
+}
+
+// The name of the chain a Protein was loaded from, which is only different
+// from the Protein's name for mmCIF chains with longer names
+string PROT::PDB::chain (const char name) const {
+    map<char, string>::const_iterator it = m_chains.find(name);
+    if (it != m_chains.end()) {return it->second;}
+    return string(1, name);
+}
@@ -0,0 +1,167 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file is intended to be included by the PDB.h header file. It implements
+ * the methods of the PDB class for files that contain several models, such as
+ * NMR structures and ensembles. The Proteins are made from the first model.
+ * Only the coordinates of the other models that have the same Atoms are kept,
+ * and the Proteins' Atoms can be moved to them. The Atoms of a model that is
+ * different are kept, and Proteins are made from them when it is used. */
+
+// Confirm that the PDB class is loading the content
+#ifndef PDB_Loading_Status
+#error PDB methods must be included by PDB.h
+#endif
+
+// How an Atom is identified when the models are lined up
+PROT::PDB::ModelAtom PROT::PDB::model_atom (const Atom& atom) {
+    ModelAtom listed;
+    listed.protein = atom.m_protein;
+    listed.insertion = atom.m_insertion;
+    listed.residue = atom.m_residue_number;
+    listed.name = atom.m_name;
+    return listed;
+}
+
+// Sorting the Atoms of a model by their Protein's name puts them in the same
+// order as the first model's
+bool PROT::PDB::model_order (const Atom& first, const Atom& second) {
+    return (first.m_protein < second.m_protein);
+}
+
+// Line the Atoms of the later models up with the Atoms of the first one. A
+// model with different Atoms does not stop the first model from being used, so
+// its Atoms are kept for when it is used
+void PROT::PDB::collect_models (vector<vector<Atom> >& models) {
+    // List the Atoms of the first model in the order the Proteins are made
+    // from them
+    m_models.resize(models.size() + 1);
+    m_model_atoms.resize(models.size() + 1);
+    for(size_t i=0; i<m_atoms.size(); ++i) {
+        for(size_t j=0; j<m_atoms[i].size(); ++j) {
+            const Atom& atom = m_atoms[i][j];
+            m_topology.push_back(model_atom(atom));
+            m_models[0].insert(m_models[0].end(), atom.m_coors,
+                               atom.m_coors + AtomCoordinates);}}
+    // Keep the coordinates of the models that have the same Atoms, and the
+    // Atoms of the others
+    for(size_t m=0; m<models.size(); ++m) {
+        vector<Atom>& atoms = models[m];
+        stable_sort(atoms.begin(), atoms.end(), model_order);
+        bool same = (atoms.size() == m_topology.size());
+        for(size_t i=0; (same) && (i<atoms.size()); ++i) {
+            same = (model_atom(atoms[i]) == m_topology[i]);}
+        if (!same) {m_model_atoms[m+1].swap(atoms); continue;}
+        vector<coor>& coordinates = m_models[m+1];
+        coordinates.reserve(atoms.size() * AtomCoordinates);
+        for(size_t i=0; i<atoms.size(); ++i) {
+            coordinates.insert(coordinates.end(), atoms[i].m_coors,
+                               atoms[i].m_coors + AtomCoordinates);}}
+}
+
+// Find where the first model's Atoms ended up in the Proteins, so that they
+// can be moved to the other models no matter what they are named afterwards
+void PROT::PDB::place_models () {
+    m_places.clear();
+    if (m_models.size() == 0) {return;}
+    // Find the Residues by their Protein's name, number and insertion code
+    unordered_map<uint64_t, ModelPlace> residues;
+    for(size_t i=0; i<m_proteins.size(); ++i) {
+        const Protein& prot = m_proteins[i];
+        for(size_t j=0; j<prot.m_count; ++j) {
+            const Residue& res = prot.m_residues[j];
+            uint64_t key = (uint64_t((unsigned char) prot.m_name) << 40) |
+                           (uint64_t((unsigned char) res.m_insertion) << 32) |
+                           uint32_t(res.m_number);
+            ModelPlace place = {i, j, 0};
+            residues[key] = place;}}
+    // Find each Atom in its Residue
+    m_places.reserve(m_topology.size());
+    for(size_t i=0; i<m_topology.size(); ++i) {
+        const ModelAtom& listed = m_topology[i];
+        uint64_t key = (uint64_t((unsigned char) listed.protein) << 40) |
+                       (uint64_t((unsigned char) listed.insertion) << 32) |
+                       uint32_t(listed.residue);
+        ModelPlace place = {m_proteins.size(), 0, 0};
+        unordered_map<uint64_t, ModelPlace>::iterator it = residues.find(key);
+        if (it != residues.end()) {
+            Residue& res = m_proteins[it->second.protein].m_residues[it->second.residue];
+            Atom * atom = res.find_atom(listed.name);
+            if (atom != 0) {
+                place = it->second;
+                place.atom = atom - res.m_atoms;}}
+        m_places.push_back(place);}
+}
+
+// Move the Atoms of the Proteins to the coordinates of a model, or make the
+// Proteins from its Atoms if they are different from the first model's
+void PROT::PDB::load_model (const size_t model) {
+    if (model >= models()) {
+        stringstream c1; c1 << models();
+        stringstream c2; c2 << model;
+        string error = m_name + " contains " + c1.str() + " models. An index "
+                       "of " + c2.str() + " is not acceptable to access one "
+                       "of them.\n";
+        throw PANTZ_error (error);}
+    if (m_models.size() == 0) {return;}
+    stringstream c; c << model + 1;
+    // A model with different Atoms gets Proteins of its own, and the first
+    // model's Proteins are kept to be used for the other models
+    if (m_models[model].size() == 0) {
+        if (m_model_atoms[model].size() == 0) {
+            string error = "Model " + c.str() + " of " + m_name + " does not "
+                           "contain any Atoms.\n";
+            throw PANTZ_error (error);}
+        if (m_first_model.size() == 0) {m_first_model.swap(m_proteins);}
+        m_proteins.clear(); m_structures.clear();
+        m_atoms.clear(); m_atoms.resize(128);
+        const vector<Atom>& atoms = m_model_atoms[model];
+        for(size_t i=0; i<atoms.size(); ++i) {
+            m_atoms[(int) atoms[i].m_protein].push_back(atoms[i]);}
+        try {
+            construct_Proteins ();
+            create_Structures ();}
+        catch (PANTZ_error& e) {
+            string error = "This occurred in model " + c.str() + " of PDB file "
+                         + m_name + "\n";
+            throw PANTZ_error (e, error);}
+        return;}
+    // Go back to the first model's Proteins if another model's were made
+    if (m_first_model.size() > 0) {
+        m_proteins.swap(m_first_model);
+        m_first_model.clear();
+        m_structures.clear();
+        create_Structures ();}
+    if (m_places.size() != m_topology.size()) {
+        string error = "The Proteins of " + m_name + " can't be moved to model "
+                     + c.str() + " before they have been made.\n";
+        throw PANTZ_error (error);}
+    // Every Atom must still be where it was found, or the Proteins would be
+    // left with Atoms from two models
+    for(size_t i=0; i<m_places.size(); ++i) {
+        const ModelPlace& place = m_places[i];
+        if ((place.protein >= m_proteins.size()) ||
+            (place.residue >= m_proteins[place.protein].m_count) ||
+            (place.atom >= m_proteins[place.protein].m_residues[place.residue].m_count)) {
+            string error = "Not every Atom of " + m_name + " is in its "
+                           "Proteins, so they can't be moved to model "
+                         + c.str() + ".\n";
+            throw PANTZ_error (error);}}
+    // Move each Atom, then update the Residues that were moved. A Residue's
+    // rotamers are placed on its backbone, so they are made again for the new
+    // coordinates when they are needed
+    const vector<coor>& coordinates = m_models[model];
+    Residue * last = 0;
+    for(size_t i=0; i<m_places.size(); ++i) {
+        const ModelPlace& place = m_places[i];
+        Residue * res = &(m_proteins[place.protein].m_residues[place.residue]);
+        if ((res != last) && (last != 0)) {
+            last->update_geometry();
+            last->m_rotamers.clear(0);}
+        last = res;
+        Atom& atom = res->m_atoms[place.atom];
+        for(size_t k=0; k<AtomCoordinates; ++k) {
+            atom.m_coors[k] = coordinates[i * AtomCoordinates + k];}}
+    if (last != 0) {
+        last->update_geometry();
+        last->m_rotamers.clear(0);}
+}
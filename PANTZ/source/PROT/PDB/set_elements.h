@@ -16,7 +16,7 @@ void PROT::PDB::set_elements () {
         for (size_t j = 0; j < m_proteins[i].size(); j++) {
             for (size_t k = 0; k < m_proteins[i](j, ' ', true)->size(); k++) {
                 char element = m_proteins[i](j, ' ', true)->get_atom(k)->determine_element();
-                m_proteins[i](j, ' ', true)->get_atom(k)->m_element = element;
+                m_proteins[i](j, ' ', true)->get_atom(k)->set_element(Names::intern(string(1, element)));
             }
         }
     }
@@ -0,0 +1,87 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file contains the declaration of the PackedAtoms class. It stores the
+ * heavy atoms of a Residue as separate arrays of coordinates and radius classes
+ * so that steric clashes between residues can be checked quickly. It also
+ * includes the header files where the methods of the class are implemented. */
+
+// Use a header guard to make sure this file is only included in a compiled
+// program a single time
+#ifndef Proteins_PackedAtoms_Guard
+#define Proteins_PackedAtoms_Guard 1
+
+// Make sure this file is being included from the Proteins.h header file
+#ifndef Proteins_Loading_Status
+#error PackedAtoms.h must be included by Proteins.h
+#endif
+
+// confirm that the Residue header files have been included
+#ifndef Proteins_Residue_Guard
+#error PackedAtoms.h must be included after Residue.h
+#endif
+
+// Define the PackedAtoms class
+class PROT::PackedAtoms {
+
+    // The information stored in the class is private
+    private:
+        // The coordinates of the atoms
+        vector<coor> m_x;
+        vector<coor> m_y;
+        vector<coor> m_z;
+        // The radius class of each atom (an index into radii())
+        vector<unsigned char> m_class;
+        // The atoms themselves, used when an atom's element has no radius
+        vector<Atom *> m_atoms;
+        // Whether or not every atom's element has a known radius
+        bool m_known;
+        // A sphere that contains the centers of all of the atoms
+        double m_center [AtomCoordinates];
+        double m_radius;
+
+    // Private methods that control class behavior
+    private:
+        // Check for clashes atom by atom with the Atom class's clash method
+        bool atom_clash (const PackedAtoms&) const;
+
+    // The public interface of the class
+    public:
+        // The number of elements with known radii
+        static const size_t Classes = 5;
+        // The default constructor
+        PackedAtoms () {m_known = true; m_radius = 0;}
+        // Pack the heavy atoms of a residue. If the boolean is true, backbone
+        // atoms are skipped too
+        PackedAtoms (Residue * residue, const bool side_chain) {load(residue, side_chain);}
+        void load (Residue * residue, const bool side_chain) {load(residue, 0, side_chain);}
+        // Pack the heavy atoms of a residue using other coordinates for them,
+        // such as those of one of its rotamers
+        void load (Residue *, const coor *, const bool);
+        // The number of packed atoms
+        size_t size () const {return m_x.size();}
+        // Whether or not every atom's element has a known radius. If not,
+        // clashes are checked with the Atoms themselves
+        bool known () const {return m_known;}
+        // Whether or not any of these atoms clash with the other atoms, using the
+        // same 90% of the summed Lennard Jones radii as Atom::clash
+        bool clash (const PackedAtoms&) const;
+        // The smallest squared distance at which two atoms of the given radius
+        // classes no longer clash
+        static float clash_limit (const size_t, const size_t);
+
+    // End the class definition
+};
+
+// Define a preprocessor variable to guarantee that the PackedAtoms methods are
+// included here and only here
+#define PackedAtoms_Loading_Status 1
+
+// Include the files that implement class methods
+#include "PackedAtoms/load.h"
+#include "PackedAtoms/clash.h"
+
+// Undefine the loading status variable
+#undef PackedAtoms_Loading_Status
+
+// End the header guard from the start of the file
+#endif
@@ -0,0 +1,84 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file is intended to be included by the PackedAtoms.h header file. It
+ * implements the functions that determine whether packed atoms clash. */
+
+// Confirm that the PackedAtoms class is loading the content
+#ifndef PackedAtoms_Loading_Status
+#error PackedAtoms methods must be included by PackedAtoms.h
+#endif
+
+// Include the limits of the float type
+#include <cfloat>
+
+// Atom::clash compares the square root of a float squared distance with 90% of
+// the summed radii. Because the square root is monotonic, that is the same as
+// comparing the squared distance itself with the smallest float whose square
+// root reaches the limit. Those values are found once for every pair of radii.
+float PROT::PackedAtoms::clash_limit (const size_t a, const size_t b) {
+    static const vector<float> limits = [] () {
+        // The same radii as Atom::lj_sigma
+        const float radii [Classes] = {1, 1.7, 1.625, 1.5, 1.782};
+        vector<float> values (Classes * Classes);
+        for(size_t i=0; i<Classes; ++i) {
+            for(size_t j=0; j<Classes; ++j) {
+                float vdw1 = radii[i];
+                float vdw2 = radii[j];
+                double limit = 0.9*(vdw1 + vdw2);
+                coor value = limit*limit;
+                while (sqrt(value) < limit) {value = nextafter(value, FLT_MAX);}
+                while ((value > 0) && (!(sqrt(nextafter(value, 0.0f)) < limit))) {
+                    value = nextafter(value, 0.0f);}
+                values[i*Classes + j] = value;}}
+        return values;}();
+    return limits[a*Classes + b];
+}
+
+// Check the atoms one pair at a time, in the same order as
+// Residue::heavy_side_chain_clash always has
+bool PROT::PackedAtoms::atom_clash (const PackedAtoms& other) const {
+    for(size_t i=m_atoms.size(); i>0; --i) {
+        for(size_t j=other.m_atoms.size(); j>0; --j) {
+            if (m_atoms[i-1]->clash(other.m_atoms[j-1])) {return true;}}}
+    return false;
+}
+
+// Determine whether any of these atoms clash with the other atoms
+bool PROT::PackedAtoms::clash (const PackedAtoms& other) const {
+    if ((m_x.size() == 0) || (other.m_x.size() == 0)) {return false;}
+    if ((!m_known) || (!other.m_known)) {return atom_clash(other);}
+    // If the bounding spheres are further apart than the largest clash
+    // distance, no pair of atoms can clash
+    double dx = m_center[0] - other.m_center[0];
+    double dy = m_center[1] - other.m_center[1];
+    double dz = m_center[2] - other.m_center[2];
+    double reach = m_radius + other.m_radius + 0.9*(2*1.782) + 0.001;
+    if (dx*dx + dy*dy + dz*dz > reach*reach) {return false;}
+    const size_t count = other.m_x.size();
+    const coor * x = other.m_x.data();
+    const coor * y = other.m_y.data();
+    const coor * z = other.m_z.data();
+    const unsigned char * radius = other.m_class.data();
+    for(size_t i=0; i<m_x.size(); ++i) {
+        // The limits for this atom with each radius class
+        float limits [Classes];
+        for(size_t c=0; c<Classes; ++c) {limits[c] = clash_limit(m_class[i], c);}
+        const coor xi = m_x[i];
+        const coor yi = m_y[i];
+        const coor zi = m_z[i];
+        // Check this atom against all of the other atoms without branching, then
+        // stop as soon as a clash is known
+        bool found = false;
+        for(size_t j=0; j<count; ++j) {
+            coor ex = xi - x[j];
+            coor ey = yi - y[j];
+            coor ez = zi - z[j];
+            // The squared distance is summed exactly as
+            // Atom::calculate_distance does it
+            coor value = (double) ex * ex;
+            value = value + (double) ey * ey;
+            value = value + (double) ez * ez;
+            found |= (value < limits[radius[j]]);}
+        if (found) {return true;}}
+    return false;
+}
@@ -0,0 +1,61 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file is intended to be included by the PackedAtoms.h header file. It
+ * implements the function that packs the heavy atoms of a Residue. */
+
+// Confirm that the PackedAtoms class is loading the content
+#ifndef PackedAtoms_Loading_Status
+#error PackedAtoms methods must be included by PackedAtoms.h
+#endif
+
+// Pack the heavy atoms of a residue, reusing the memory from any previous load.
+// If coordinates are provided, they replace the atoms' own coordinates
+void PROT::PackedAtoms::load (Residue * residue, const coor * coordinates, const bool side_chain) {
+    m_x.clear();
+    m_y.clear();
+    m_z.clear();
+    m_class.clear();
+    m_atoms.clear();
+    m_known = true;
+    for(size_t i=0; i<residue->size(); ++i) {
+        Atom * atom = residue->get_atom(i);
+        // Hydrogens are skipped, as are backbone atoms if only the side chain
+        // is wanted
+        Names::ID element = atom->element_id();
+        if (element == Names::H) {continue;}
+        if ((side_chain) && (atom->is_backbone_atom())) {continue;}
+        // The radius classes follow the order of Atom::lj_sigma
+        unsigned char radius = 0;
+        if (element == Names::C) {radius = 1;}
+        else if (element == Names::N) {radius = 2;}
+        else if (element == Names::O) {radius = 3;}
+        else if (element == Names::S) {radius = 4;}
+        // An element without a radius means that clashes must be found atom by
+        // atom, where the Atom class will report the problem
+        else {m_known = false;}
+        if (coordinates != 0) {
+            m_x.push_back(coordinates[AtomCoordinates*i]);
+            m_y.push_back(coordinates[AtomCoordinates*i + 1]);
+            m_z.push_back(coordinates[AtomCoordinates*i + 2]);}
+        else {
+            m_x.push_back(atom->x());
+            m_y.push_back(atom->y());
+            m_z.push_back(atom->z());}
+        m_class.push_back(radius);
+        m_atoms.push_back(atom);}
+    // Find a sphere that contains every atom
+    for(size_t i=0; i<AtomCoordinates; ++i) {m_center[i] = 0;}
+    m_radius = 0;
+    if (m_x.size() == 0) {return;}
+    for(size_t i=0; i<m_x.size(); ++i) {
+        m_center[0] += m_x[i];
+        m_center[1] += m_y[i];
+        m_center[2] += m_z[i];}
+    for(size_t i=0; i<AtomCoordinates; ++i) {m_center[i] /= m_x.size();}
+    for(size_t i=0; i<m_x.size(); ++i) {
+        double dx = m_x[i] - m_center[0];
+        double dy = m_y[i] - m_center[1];
+        double dz = m_z[i] - m_center[2];
+        double distance = sqrt(dx*dx + dy*dy + dz*dz);
+        if (distance > m_radius) {m_radius = distance;}}
+}
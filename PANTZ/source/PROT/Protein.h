@@ -21,11 +21,16 @@
 #error Protein.h must be included after Residue.h
 #endif
 
+// The coordinate buffer is given to Eigen without copying it
+#include "../external/Eigen/Dense"
+
 // Declare the Protein class
 class PROT::Protein {
 
     // The PDB class is a friend
     friend class PROT::PDB;
+    // So is the Snapshot class, which makes Proteins from shared Residues
+    friend class PROT::Snapshot;
 
     // The information stored in the Protein is private
     private:
@@ -35,6 +40,10 @@ class PROT::Protein {
         size_t m_count;
         // The Residues themselves
         Residue * m_residues;
+        // The coordinates of the Residues' Atoms, x y and z of each Atom in a
+        // row. The Atoms keep their coordinates here unless their Residue's
+        // Atoms have been replaced since the Protein was last packed
+        vector<coor> m_coordinates;
 
     // Private methods that control class behavior
     private:
@@ -45,6 +54,8 @@ class PROT::Protein {
         // Copy information from another instance of the class
         void copy (const Protein *);
         void copy (const Protein& other) {copy(&other);}
+        // Take the Residues of a Protein that is about to be destroyed
+        void take (Protein&);
         // Validate that a set of Residues are acceptable for use in a Protein
         void check_residues (vector<Residue>&) const;
         // Private methods for moving and rotating a protein
@@ -74,8 +85,13 @@ class PROT::Protein {
         Protein (const Protein& other) {initialize(); copy(other);}
         Protein (const Protein * other) {initialize(); copy(other);}
         // Copy assignment
-        void operator= (const Protein& other) {copy(other);}
-        void operator= (const Protein * other) {copy(other);}
+        Protein& operator= (const Protein& other) {copy(other); return *this;}
+        Protein& operator= (const Protein * other) {copy(other); return *this;}
+        // Move construction and assignment
+        Protein (Protein&& other) noexcept {initialize(); take(other);}
+        Protein& operator= (Protein&& other) noexcept {
+            if (this != &other) {take(other);}
+            return *this;}
         // A formatted string of text containing all of the Protein's
         // information
         string str (const bool);
@@ -114,6 +130,7 @@ class PROT::Protein {
         void rotate (const Matrix *);
         void rotate (const Matrix&);
         // Get a list of Atoms from the Protein
+        void select_atoms (vector<Atom *>&, const Residue::Selection);
         void select_atoms (vector<Atom *>&, const string);
         void select_atoms (vector<AtomPtr>&, const string);
         // Center a Protein so the indicated atoms are at the origin on average
@@ -134,6 +151,17 @@ class PROT::Protein {
         void calculate_dihedrals ();
         // Make a duplicate of the Protein
         Protein duplicate () const;
+        // Store the coordinates of every Atom in one buffer, whether or not
+        // they are all there, and the buffer itself (which is packed again if
+        // it needs to be)
+        void pack ();
+        bool packed () const;
+        coor * coordinates ();
+        // The same buffer as an Eigen matrix with a row for each Atom. The
+        // matrix uses the buffer in place, so changing it moves the Atoms
+        typedef Eigen::Map<Eigen::Matrix<coor, Eigen::Dynamic, AtomCoordinates,
+                                         Eigen::RowMajor> > CoordinateMatrix;
+        CoordinateMatrix coordinate_matrix ();
     // End the class definition
 };
 
@@ -162,6 +190,7 @@ class PROT::Protein {
 #include "Protein/fasta.h"
 #include "Protein/dihedrals.h"
 #include "Protein/duplicate.h"
+#include "Protein/pack.h"
 
 // Undefine the Protein class loading guard
 #undef ProteinClass_Loading_Status
@@ -12,4 +12,5 @@
 // Delete dynamically allocated memory
 void PROT::Protein::clean_up () {
     if (m_residues != 0) {delete[] m_residues; m_residues = 0;}
+    m_coordinates.clear();
 }
@@ -2,7 +2,8 @@
  *
  * This file is intended to be included in a compiled program by the Protein.h
  * header file, and includes pre-processor directives to that effect. It defines
- * the copy method of the Protein class. */
+ * the copy method of the Protein class and the take method that moves the
+ * Residues out of another Protein. */
 
 // Make sure that the Protein class is currently being loaded
 #ifndef ProteinClass_Loading_Status
@@ -21,4 +22,19 @@ void PROT::Protein::copy (const Protein * other) {
     if (m_count > 0) {
         m_residues = new Residue [m_count];
         for(size_t i=0; i<m_count; ++i) {m_residues[i] = other->m_residues[i];}}
+    pack();
+}
+
+// Take the Residues of a Protein that is about to be destroyed. Moving the
+// coordinate buffer does not move the coordinates in memory, so the Atoms keep
+// using it
+void PROT::Protein::take (Protein& other) {
+    clean_up();
+    m_name = other.m_name;
+    m_count = other.m_count;
+    m_residues = other.m_residues;
+    m_coordinates = std::move(other.m_coordinates);
+    other.m_count = 0;
+    other.m_residues = 0;
+    other.m_coordinates.clear();
 }
@@ -24,5 +24,6 @@ PROT::Protein PROT::Protein::duplicate () const {
         // Copy the residues
         for(size_t i=0; i<m_count; ++i) {
             output.m_residues[i] = m_residues[i];}}
+    output.pack();
     return output;
 }
@@ -53,6 +53,8 @@ void PROT::Protein::load (vector<Residue>& residues) {
     m_residues[m_count-1].m_C_terminus = true;
     // make sure atoms are sequentially numbered
     long n = renumber_atoms (1);
+    // store the atoms' coordinates together
+    pack();
 }
 
 // Load a Protein from a vector of Atoms
@@ -104,11 +106,12 @@ void PROT::Protein::load (const vector<string>& contents) {
                        "strings.\n";
         throw PANTZ_error (error);}
     // Convert them to Atoms
-    vector<Atom> atoms;
+    vector<Atom> atoms; atoms.reserve(contents.size());
     for(size_t i=0; i<contents.size(); ++i) {
-        // not everything will might be an Atom, so only store the Atom objects
-        try{atoms.push_back(Atom(contents[i]));}
-        catch(PANTZ_error) {continue;}}
+        // not everything will be an Atom, so only store the Atom objects
+        Atom atom;
+        if (atom.read(contents[i].data(), contents[i].size())) {
+            atoms.push_back(std::move(atom));}}
     // Load them
     try {load(atoms);}
     catch (PANTZ_error& e) {
@@ -122,19 +125,31 @@ void PROT::Protein::load (const string& fileName, const string path = "./") {
     // create the file name for loading
     string use = path + fileName;
     // Attempt to open that file
-    ifstream input; input.open(use.c_str());
-    if (!input.is_open()) {
+    MappedFile input;
+    if (!input.open(use)) {
         string error = "Failure to open this Protein file:\nName: "
                      + fileName + "\nLocation: " + path + "\n";
         throw PANTZ_error(error);}
-    // Store the contents as string
-    vector<string> contents;
-    string line; getline(input, line);
-    while (!input.eof()) {
-        contents.push_back(line); getline(input, line);}
+    // Read the Atoms directly from the lines of the file that are ended by a
+    // new line character
+    const char * text = input.data();
+    const size_t size = input.size();
+    vector<Atom> atoms; atoms.reserve(size / AtomStringLength + 1);
+    size_t lines = 0, start = 0;
+    const char * end;
+    while ((end = static_cast<const char *>(memchr(text + start, '\n',
+                                                   size - start))) != 0) {
+        Atom atom;
+        if (atom.read(text + start, end - (text + start))) {
+            atoms.push_back(std::move(atom));}
+        start = (end - text) + 1; ++lines;}
     input.close();
     // Load them
-    try {load(contents);}
+    try {
+        if (lines == 0) {
+            string error = "A Protein cannot be loaded from an empty file.\n";
+            throw PANTZ_error (error);}
+        load(atoms);}
     catch (PANTZ_error& e) {
         string error = "This error occurred in the file-based load method of "
                        "the Protein class.\n";
@@ -12,7 +12,18 @@
 // A private method that moves the protein without error checking either the
 // matrix or the how character
 void PROT::Protein::private_move (const Matrix * mat, const char how) {
-    if (m_count > 0) {
+    // If the atoms are packed, move the whole buffer at once
+    if ((m_count > 0) && (packed())) {
+        coor shift [AtomCoordinates];
+        for(size_t i=0; i<AtomCoordinates; ++i) {
+            shift[i] = mat->operator()(0, i);}
+        size_t n = m_coordinates.size();
+        if (how == '-') {
+            for(size_t i=0; i<n; ++i) {m_coordinates[i] -= shift[i % AtomCoordinates];}}
+        else {
+            for(size_t i=0; i<n; ++i) {m_coordinates[i] += shift[i % AtomCoordinates];}}
+        for(size_t i=0; i<m_count; ++i) {m_residues[i].update_geometry();}}
+    else if (m_count > 0) {
         for(size_t i=0; i<m_count; ++i) {m_residues[i].private_move(mat, how);}}
 }
 
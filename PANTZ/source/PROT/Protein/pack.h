@@ -0,0 +1,57 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file is intended to be included in a compiled program by the Protein.h
+ * header file, and includes pre-processor directives to that effect. It defines
+ * the methods that store the coordinates of a Protein's Atoms in one buffer. */
+
+// Make sure that the Protein class is currently being loaded
+#ifndef ProteinClass_Loading_Status
+#error Protein methods must be included by the Protein.h header file
+#endif
+
+// Store the coordinates of every Atom in the Protein in one buffer, in the
+// order of the Residues and their Atoms, and make the Atoms use it
+void PROT::Protein::pack () {
+    // Fill a new buffer first, because some of the Atoms may still use the
+    // current one
+    vector<coor> buffer (number_of_atoms() * AtomCoordinates);
+    size_t n = 0;
+    for(size_t i=0; i<m_count; ++i) {
+        for(size_t j=0; j<m_residues[i].m_count; ++j) {
+            const coor * coordinates = m_residues[i].m_atoms[j].m_coors;
+            for(size_t k=0; k<AtomCoordinates; ++k) {buffer[n++] = coordinates[k];}}}
+    m_coordinates.swap(buffer);
+    n = 0;
+    for(size_t i=0; i<m_count; ++i) {
+        for(size_t j=0; j<m_residues[i].m_count; ++j) {
+            m_residues[i].m_atoms[j].m_coors = &m_coordinates[n];
+            n += AtomCoordinates;}}
+}
+
+// Whether or not every Atom uses its place in the coordinate buffer. An Atom
+// stops using it when its Residue's Atoms are replaced
+bool PROT::Protein::packed () const {
+    size_t n = 0;
+    for(size_t i=0; i<m_count; ++i) {
+        for(size_t j=0; j<m_residues[i].m_count; ++j) {
+            if ((n >= m_coordinates.size()) ||
+                (m_residues[i].m_atoms[j].m_coors != &m_coordinates[n])) {
+                return false;}
+            n += AtomCoordinates;}}
+    return (n == m_coordinates.size());
+}
+
+// The coordinates of every Atom in the Protein, x y and z of each Atom in a
+// row. The Atoms are packed again first if they need to be
+PROT::coor * PROT::Protein::coordinates () {
+    if (!packed()) {pack();}
+    if (m_coordinates.size() == 0) {return 0;}
+    return m_coordinates.data();
+}
+
+// The coordinates of every Atom as an Eigen matrix that uses the buffer
+PROT::Protein::CoordinateMatrix PROT::Protein::coordinate_matrix () {
+    coor * buffer = coordinates();
+    return CoordinateMatrix(buffer, m_coordinates.size() / AtomCoordinates,
+                            AtomCoordinates);
+}
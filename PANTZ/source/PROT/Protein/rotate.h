@@ -11,7 +11,17 @@
 
 // Rotate the protein without error checking the matrix
 void PROT::Protein::private_rotate (const Matrix * mat) {
-    if (m_count > 0) {
+    // If the atoms are packed, rotate the whole buffer at once. Each row is
+    // an Atom, so the rows are multiplied by the transpose of the matrix
+    if ((m_count > 0) && (packed())) {
+        Eigen::Matrix<coor, AtomCoordinates, AtomCoordinates> transpose;
+        for(size_t i=0; i<AtomCoordinates; ++i) {
+            for(size_t j=0; j<AtomCoordinates; ++j) {
+                transpose(j, i) = mat->operator()(i, j);}}
+        CoordinateMatrix atoms = coordinate_matrix();
+        atoms = atoms * transpose;
+        for(size_t i=0; i<m_count; ++i) {m_residues[i].update_geometry();}}
+    else if (m_count > 0) {
         for(size_t i=0; i<m_count; ++i) {m_residues[i].private_rotate(mat);}}
 }
 
@@ -10,8 +10,8 @@
 #endif
 
 // Select atoms and store them as pointers
-void PROT::Protein::select_atoms (vector<Atom *>& atoms, 
-                                  const string how = "all") {
+void PROT::Protein::select_atoms (vector<Atom *>& atoms,
+                                  const Residue::Selection how) {
     // Make sure the protein is not empty
     if (m_count == 0) {
         string error = "It is not possible to select atoms from an empty "
@@ -23,6 +23,18 @@ void PROT::Protein::select_atoms (vector<Atom *>& atoms,
         m_residues[i].select_atoms(atoms, how);}
 }
 
+// Select atoms with a string that describes the selection, which is only
+// interpreted once for all of the residues
+void PROT::Protein::select_atoms (vector<Atom *>& atoms, 
+                                  const string how = "all") {
+    // Make sure the protein is not empty
+    if (m_count == 0) {
+        string error = "It is not possible to select atoms from an empty "
+                       "Protein.\n";
+        throw PANTZ_error (error);}
+    select_atoms(atoms, Residue::selection(how));
+}
+
 // Store them as AtomPtrs
 void PROT::Protein::select_atoms (vector<AtomPtr>& atoms,
                                   const string how = "all") {
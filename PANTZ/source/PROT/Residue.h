@@ -63,16 +63,27 @@ class PROT::Residue {
         coor m_psi;
         coor m_omega;
 
-        // the stbaility of the residue in the context of the protein
-        bool m_prestable = false;
-        // the stability of the residue in the context of the protein complex
-        bool m_bound_stable = false;
-        // the rotamers of the residue
-        vector<PROT::Residue> m_rotamers;
+        // the coordinates of the rotamers of the residue, which have the same
+        // atoms as the residue
+        PROT::Rotamers m_rotamers;
         // the intraprotein neighbors of the residue
         vector<PROT::Residue*> m_intra_neighbors;
         // the interprotein neighbors of the residue
         vector<PROT::Residue*> m_inter_neighbors;
+        // Where the Residue is, which is updated whenever its atoms change:
+        // the index of its CA atom (m_count if it does not have one), the
+        // centroid of its side chain atoms (or of all of its atoms if it has
+        // no side chain) and the radius of a sphere around the centroid that
+        // contains every atom
+        size_t m_CA;
+        coor m_centroid [AtomCoordinates];
+        coor m_bounding_radius;
+        // The standard amino acid of the Residue (-1 if it is not one) and
+        // the place of each of the amino acid's atoms in m_atoms, plus one (0
+        // if the Residue does not have that atom)
+        static const size_t AtomSlots = 40;
+        int8_t m_type;
+        uint8_t m_slots [AtomSlots];
         
     // Private functions that control the behaviour of the Residue
     private:
@@ -83,6 +94,9 @@ class PROT::Residue {
         // Copy information from another Residue
         void copy (const Residue *);
         void copy (const Residue& other) {copy(&other);}
+        // Take the Atoms and information of a Residue that is about to be
+        // destroyed
+        void take (Residue&);
         // Private functions to set residue information
         void private_set_number (const long, const char, const bool);
         void private_set_protein (const char);
@@ -92,9 +106,17 @@ class PROT::Residue {
         // error check the matrix
         void private_move (const Matrix *, const char);
         void private_rotate (const Matrix *);
+        // Find the CA atom and calculate the centroid and bounding radius
+        void update_geometry ();
+        // Work out the Residue's amino acid and where its atoms are, which has
+        // to be done whenever the Atoms or their names change
+        void index_atoms ();
+        // The tables of the atoms of each amino acid, which are built the
+        // first time they are needed and only read after that
+        struct SlotTable;
+        static const SlotTable& slot_table ();
+        PROT::Atom * slot_atom (const size_t);
         // size_t free_rotamers(vector<PROT::Residue>, vector<PROT::Residue*>);
-        // the utility function to determine the stability of the residue
-        // bool stable (vector<PROT::Residue*>, vector<PROT::Residue*>);
 
     // The public interface of the Residue class
     public:
@@ -117,12 +139,18 @@ class PROT::Residue {
         Residue (const Residue& other) {initialize(); copy(&other);}
         Residue (const Residue * other) {initialize(); copy(other);}
         // Copy assignment
-        void operator= (const Residue& other) {copy(&other);}
-        void operator= (const Residue * other) {copy(other);}
+        Residue& operator= (const Residue& other) {copy(&other); return *this;}
+        Residue& operator= (const Residue * other) {copy(other); return *this;}
+        // Move construction and assignment
+        Residue (Residue&& other) noexcept {initialize(); take(other);}
+        Residue& operator= (Residue&& other) noexcept {
+            if (this != &other) {take(other);}
+            return *this;}
         // Access to the Residue's information
         size_t size () const {return m_count;}
         string name () const {return m_name;}
         char AA1 () const;
+        PROT::AminoAcid amino_acid () const;
         long number () const {return m_number;}
         long internal_number () const {return m_internal;}
         char insertion_code () const {return m_insertion;}
@@ -135,6 +163,10 @@ class PROT::Residue {
         // Access to the Residue's Atoms by number or name
         PROT::Atom * get_atom (const size_t);
         PROT::Atom * get_atom (const string&);
+        // Find an Atom by its name or the ID of its name, returning 0 instead
+        // of raising an error if the Residue does not have it
+        PROT::Atom * find_atom (const string&);
+        PROT::Atom * find_atom (const Names::ID);
         PROT::AtomPtr operator[] (const size_t);
         PROT::AtomPtr operator[] (const string&);
         // Functions that allow for the setting of a Residue's number and
@@ -155,7 +187,16 @@ class PROT::Residue {
         void move (const Matrix&, const bool);
         void rotate (const Matrix *);
         void rotate (const Matrix&);
+        // The ways a subset of Atoms can be selected from the Residue, and the
+        // selection that a string describes ("all", "heavy", "sidechain all",
+        // "sidechain heavy", "backbone all", "backbone heavy", "backbone main",
+        // "CA" or "rotamer")
+        enum Selection {SelectAll, SelectHeavy, SelectSidechain,
+                        SelectSidechainHeavy, SelectBackbone, SelectBackboneHeavy,
+                        SelectBackboneMain, SelectCA, SelectRotamer};
+        static Selection selection (const string&);
         // Select a subset of Atoms from the Residue
+        void select_atoms (vector<Atom *>&, const Selection);
         void select_atoms (vector<Atom *>&, const string);
         void select_atoms (vector<AtomPtr>&, const string);
         // Move a Residue so that its center of mass is at the origin
@@ -183,10 +224,23 @@ class PROT::Residue {
         // its atoms.
         PROT::Residue duplicate () const;
 
+        // The CA atom, the side chain centroid and the radius of a sphere
+        // around the centroid that contains every atom
+        PROT::Atom * CA ();
+        const PROT::Atom * CA () const;
+        const coor * centroid () const {return m_centroid;}
+        coor bounding_radius () const {return m_bounding_radius;}
+        // Whether or not an atom of this residue could be within a distance
+        // of an atom of another residue, based on their bounding spheres
+        bool near (const Residue&, const float) const;
+        // The coordinates of the Residue's atoms, x y and z of each atom in a
+        // row, when they are stored together in a Protein's coordinate
+        // buffer. Otherwise this is 0
+        const coor * coordinates () const;
         // x y and z coordinates of alpha carbon (for convenience in the KDtree class)
-        float x() {return get_atom("CA")->x();}
-        float y() {return get_atom("CA")->y();}
-        float z() {return get_atom("CA")->z();}
+        float x() const {return CA()->x();}
+        float y() const {return CA()->y();}
+        float z() const {return CA()->z();}
         // distance to another residue CA atoms
         float distance (Residue&);
         // minimum distance between two residues
@@ -195,34 +249,39 @@ class PROT::Residue {
         bool operator< (const Residue&) const;
         // function to count the number of hydrogen bonds between two residues
         // parameters are the other residue, the distance cutoff, and the angles
-        // between donor-hydrogen-acceptor and donor-acceptor-antecedent
-        vector<PROT::HydrogenBond> hbond(Residue *, float, float, float, bool);
+        // between donor-hydrogen-acceptor and donor-acceptor-antecedent. The
+        // verbose output is written to the provided stream
+        vector<PROT::HydrogenBond> hbond(Residue *, float, float, float, bool, ostream& = cout);
         // function to find a salt bridge with another residue
         // the parameters are the other residue, the distance cutoff, and a verbose bool
-        vector<SaltBridge> salt_bridge(Residue *, float, bool);
+        vector<SaltBridge> salt_bridge(Residue *, float, bool, ostream& = cout);
         // function to find hydrophobic interactions between two residues
         // the parameters are the other residue and a verbose bool
-        vector<PROT::Hydrophobic> hydrophobic(Residue *, float, bool);
+        vector<PROT::Hydrophobic> hydrophobic(Residue *, float, bool, ostream& = cout);
         // function to get the rotamers of this residue
         void set_rotamers();
         // function to get the rotamers of this residue (set them if m_rotamers is empty)
-        vector<PROT::Residue> get_rotamers() {if (m_rotamers.size() == 0) {set_rotamers();} return m_rotamers;}
-        size_t free_rotamers(vector<PROT::Residue>, vector<PROT::Residue*>);
+        const PROT::Rotamers& get_rotamers() {if (m_rotamers.size() == 0) {set_rotamers();} return m_rotamers;}
+        // access the rotamers that have already been set, without setting them
+        const PROT::Rotamers& rotamers() const {return m_rotamers;}
+        // make a copy of this residue with the coordinates of one of its rotamers
+        PROT::Residue rotamer(const size_t);
+        PROT::Residue rotamer(const PROT::Rotamers&, const size_t);
+        size_t free_rotamers(const PROT::Rotamers&, const vector<PROT::Residue*>&);
         // function to get the neighbors of this residue
         vector<PROT::Residue*> get_intra_neighbors(PROT::Protein*, float);
         vector<PROT::Residue*> get_intra_neighbors(vector<PROT::Residue*>, float);
         vector<PROT::Residue*> get_inter_neighbors(vector<PROT::Protein*>, float);
         vector<PROT::Residue*> get_inter_neighbors_res(vector<PROT::Residue*>, float);
-        // function to set the stability of the residue
-        void set_stability(vector<PROT::Residue>, vector<PROT::Residue*>, bool, string&);
-        // access the prestability of the residue
-        bool prestable () {return m_prestable;}
-        // access the bound stability of the residue
-        bool bound_stable () {return m_bound_stable;}
+        // the utility function to determine the stability of the residue
+        // without storing it, so that it may be called from several threads
+        bool stable(const PROT::Rotamers&, vector<PROT::Residue*>&, bool);
+        bool stable(const size_t, const size_t, vector<PROT::Residue*>&, bool);
         // function to check if two residues are clashing sterically
         bool clash (Residue*);
         bool heavy_clash (Residue*);
         bool heavy_side_chain_clash (Residue*);
+        bool heavy_side_chain_atom_clash (Residue*);
         // remove side chains
         void remove_sidechain ();
         // calculate the rmsd between this residue and another
@@ -265,6 +324,7 @@ class PROT::ResiduePtr {
         size_t size () const {check(); return m_ptr->size();}
         string name () const {check(); return m_ptr->name();}
         char AA1 () const {check(); return m_ptr->AA1();}
+        PROT::AminoAcid amino_acid () const {check(); return m_ptr->amino_acid();}
         long number () const {check(); return m_ptr->number();}
         long internal_number () const {check(); return m_ptr->internal_number();}
         char insertion_code () const {check(); return m_ptr->insertion_code();}
@@ -300,6 +360,7 @@ class PROT::ResiduePtr {
         void rotate (const Matrix& m) {check(); m_ptr->rotate(m);}
         // The select atoms methods also have default behaviors and are
         // implemented with their Residue counterparts
+        void select_atoms (vector<Atom *>&, const Residue::Selection);
         void select_atoms (vector<Atom *>&, const string);
         void select_atoms (vector<AtomPtr>&, const string);
         // Center makes use of select atoms and has default behavior
@@ -355,6 +416,8 @@ class PROT::ResiduePtr {
 #include "Residue/histidine.h"
 #include "Residue/rosetta.h"
 #include "Residue/duplicate.h"
+#include "Residue/geometry.h"
+#include "Residue/slots.h"
 // added by clay
 #include "Residue/distance.h"
 #include "Residue/hbond.h"
@@ -35,11 +35,11 @@ void PROT::Residue::check_atoms (const vector<PROT::Atom *>& atoms) const {
     // Confirm that each ATOM entry has a unique name
     for(size_t i=0; i<atoms.size()-1; ++i) {
         // Skip HETATM entries
-        if (atoms[i]->m_type == "HETATM") {continue;}
+        if (atoms[i]->m_hetatm) {continue;}
         // Loop through all subsequent atoms
         for(size_t j=i+1; j<atoms.size(); ++j) {
             // Skip HETATM entries
-            if (atoms[j]->m_type == "HETATM") {continue;}
+            if (atoms[j]->m_hetatm) {continue;}
             // Throw an error if the two atoms have the same name
             if (atoms[i]->m_name == atoms[j]->m_name) {
                 string error = "Each Atom in a Residue must have a unique name."
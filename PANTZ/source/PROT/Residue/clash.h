@@ -9,6 +9,8 @@
 #error Methods of the Residue class must be loaded from the Residue.h header file
 #endif
 
+#include "../PackedAtoms.h"
+
 // determine if the atoms of this residue clash with the atoms of another residue
 bool PROT::Residue::clash(PROT::Residue* other) {
     // iterate through m_atoms backwards and check for clashes
@@ -35,7 +37,7 @@ bool PROT::Residue::heavy_clash(PROT::Residue* other) {
         // get the atom
         PROT::Atom * atom = &m_atoms[i-1];
         // if the atom is a hydrogen, skip it
-        if (atom->m_element == "H") {
+        if (atom->m_element == Names::H) {
             continue;
         }
         // iterate through the other residue's atoms
@@ -43,7 +45,7 @@ bool PROT::Residue::heavy_clash(PROT::Residue* other) {
             // get the other atom
             PROT::Atom * other_atom = &other->m_atoms[j-1];
             // if the other atom is a hydrogen, skip it
-            if (other_atom->m_element == "H") {
+            if (other_atom->m_element == Names::H) {
                 continue;
             }
             // check for a clash
@@ -57,13 +59,22 @@ bool PROT::Residue::heavy_clash(PROT::Residue* other) {
 
 // determine if the side chain atoms of this residue clash with the atoms of another residue
 bool PROT::Residue::heavy_side_chain_clash(PROT::Residue* other) {
+    // pack the side chain heavy atoms of this residue and the heavy atoms of
+    // the other residue
+    PROT::PackedAtoms side_chain (this, true);
+    PROT::PackedAtoms atoms (other, false);
+    return side_chain.clash(atoms);
+}
+
+// the same check, one pair of atoms at a time
+bool PROT::Residue::heavy_side_chain_atom_clash(PROT::Residue* other) {
     // iterate through m_atoms backwards and check for clashes
     for (size_t i = m_count; i > 0; i--) {
         // get the atom
         PROT::Atom * atom = &m_atoms[i-1];
         
         // if the atom is a hydrogen, skip it
-        if (atom->m_element == "H" or atom->is_backbone_atom()) {
+        if (atom->m_element == Names::H or atom->is_backbone_atom()) {
             continue;
         }
         // iterate through the other residue's atoms
@@ -71,8 +82,8 @@ bool PROT::Residue::heavy_side_chain_clash(PROT::Residue* other) {
             // get the other atom
             PROT::Atom * other_atom = &other->m_atoms[j-1];
             // if the other atom is a hydrogen, skip it
-            // if (other_atom->m_element == "H" or other_atom->is_backbone_atom()) {
-            if (other_atom->m_element == "H") {
+            // if (other_atom->m_element == Names::H or other_atom->is_backbone_atom()) {
+            if (other_atom->m_element == Names::H) {
                 continue;
             }
             // check for a clash
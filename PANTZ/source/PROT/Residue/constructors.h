@@ -34,5 +34,7 @@ PROT::Residue::Residue (const string& input, const char L) {
     m_name = input;
     // Set the Protein's name
     m_protein = L;
+    // Work out the Residue's amino acid from its name
+    index_atoms();
     // The remaining attributes can be left as their initialized values
 }
@@ -2,7 +2,8 @@
  *
  * This file is intended to be loaded directly from the Residue.h header file,
  * and has preprocessor directives to control that behavior. It contains the
- * pointer-based copy method of the Residue class. */
+ * pointer-based copy method of the Residue class and the take method that
+ * moves the Atoms out of another Residue. */
 
 // Make sure that the Residue class is currently loading methods
 #ifndef Residue_Loading_Status
@@ -11,14 +12,15 @@
 
 // Copy the information from another Residue into this one
 void PROT::Residue::copy (const Residue * other) {
-    // Clean up any existing information
-    clean_up();
-    // Get the number of Atoms in the other residue
-    m_count = other->m_count;
-    // If there are Atoms, allocate and copy them
-    if (m_count > 0) {
-        m_atoms = new PROT::Atom [m_count];
-        for(size_t i=0; i<m_count; ++i) {m_atoms[i] = other->m_atoms[i];}}
+    // If the other Residue has a different number of Atoms, replace this
+    // Residue's Atoms. The new Atoms keep their own coordinates. Otherwise the
+    // Atoms are copied in place, so they stay in a Protein's coordinate buffer
+    // if they are in one
+    if ((m_atoms == 0) || (m_count != other->m_count)) {
+        clean_up();
+        m_count = other->m_count;
+        if (m_count > 0) {m_atoms = new PROT::Atom [m_count];}}
+    for(size_t i=0; i<m_count; ++i) {m_atoms[i] = other->m_atoms[i];}
     // Copy the other attributes
     m_name = other->m_name;
     m_number = other->m_number;
@@ -30,4 +32,39 @@ void PROT::Residue::copy (const Residue * other) {
     m_phi = other->m_phi;
     m_psi = other->m_psi;
     m_omega = other->m_omega;
+    update_geometry();
+    index_atoms();
+}
+
+// Take the Atoms and information of a Residue that is about to be destroyed.
+// The same information is taken as is copied by the copy method
+void PROT::Residue::take (Residue& other) {
+    // Delete this Residue's Atoms and take the other's
+    clean_up();
+    m_atoms = other.m_atoms;
+    m_count = other.m_count;
+    other.m_atoms = 0;
+    other.m_count = 0;
+    // The Atoms are leaving the Residue they were in, so they keep their own
+    // coordinates instead of a place in its Protein's coordinate buffer
+    for(size_t i=0; i<m_count; ++i) {m_atoms[i].detach();}
+    // Take the other attributes
+    m_name = std::move(other.m_name);
+    m_number = other.m_number;
+    m_internal = other.m_internal;
+    m_insertion = other.m_insertion;
+    m_protein = other.m_protein;
+    m_present = other.m_present;
+    m_missing_atoms = other.m_missing_atoms;
+    m_phi = other.m_phi;
+    m_psi = other.m_psi;
+    m_omega = other.m_omega;
+    // The Atoms have not changed, so neither has where the Residue is
+    m_CA = other.m_CA;
+    for(size_t i=0; i<AtomCoordinates; ++i) {m_centroid[i] = other.m_centroid[i];}
+    m_bounding_radius = other.m_bounding_radius;
+    m_type = other.m_type;
+    for(size_t i=0; i<AtomSlots; ++i) {m_slots[i] = other.m_slots[i];}
+    other.update_geometry();
+    other.index_atoms();
 }
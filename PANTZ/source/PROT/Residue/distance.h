@@ -11,7 +11,7 @@
 // get the distance between CA atoms of two residues
 float PROT::Residue::distance (Residue& other) {
     // get the distance from this CA atom to the other CA atom
-    float distance = get_atom("CA")->distance(*other.get_atom("CA"));
+    float distance = CA()->distance(*other.CA());
     return distance;
 }
 
@@ -30,6 +30,8 @@ PROT::Residue PROT::Residue::duplicate () const {
         other.m_atoms = new PROT::Atom [m_count];
         for(size_t i=0; i<m_count; ++i) {
             other.m_atoms[i] = m_atoms[i];}}
+    other.index_atoms();
+    other.update_geometry();
     // Return the other residue
     return other;
 }
@@ -0,0 +1,81 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file is intended to be loaded directly from the Residue.h header file,
+ * and has preprocessor directives to control that behavior. It contains the
+ * methods that keep track of where a Residue is: its CA atom, the centroid of
+ * its side chain and a sphere around that centroid that holds all of its
+ * atoms. These are updated by every method that moves or changes the Residue's
+ * atoms, so they can be read by several threads at once. */
+
+// Make sure that the Residue class is currently loading methods
+#ifndef Residue_Loading_Status
+#error Methods of the Residue class must be loaded from the Residue.h header file
+#endif
+
+// Find the CA atom and calculate the side chain centroid and bounding radius
+void PROT::Residue::update_geometry () {
+    m_CA = m_count;
+    for(size_t i=0; i<AtomCoordinates; ++i) {m_centroid[i] = 0;}
+    m_bounding_radius = 0;
+    if (m_count == 0) {return;}
+    // The centroid of the side chain atoms, or of every atom if there is no
+    // side chain
+    double sums [AtomCoordinates] = {0, 0, 0};
+    size_t n = 0;
+    static const Names::ID CA = Names::intern("CA");
+    for(size_t i=0; i<m_count; ++i) {
+        if ((m_CA == m_count) && (m_atoms[i].m_name == CA)) {m_CA = i;}
+        if (m_atoms[i].is_backbone_atom()) {continue;}
+        for(size_t j=0; j<AtomCoordinates; ++j) {sums[j] += m_atoms[i].m_coors[j];}
+        n += 1;}
+    if (n == 0) {
+        for(size_t i=0; i<m_count; ++i) {
+            for(size_t j=0; j<AtomCoordinates; ++j) {sums[j] += m_atoms[i].m_coors[j];}}
+        n = m_count;}
+    for(size_t j=0; j<AtomCoordinates; ++j) {m_centroid[j] = sums[j] / n;}
+    // The radius of the sphere that contains every atom. It is made slightly
+    // larger so that rounding can never put an atom outside of it
+    double radius = 0;
+    for(size_t i=0; i<m_count; ++i) {
+        double squared = 0;
+        for(size_t j=0; j<AtomCoordinates; ++j) {
+            double d = m_atoms[i].m_coors[j] - m_centroid[j];
+            squared += d * d;}
+        if (squared > radius) {radius = squared;}}
+    m_bounding_radius = sqrt(radius) + 1e-3;
+}
+
+// The CA atom of the Residue
+PROT::Atom * PROT::Residue::CA () {
+    if (m_CA < m_count) {return &(m_atoms[m_CA]);}
+    // get_atom raises the appropriate error
+    return get_atom("CA");
+}
+
+const PROT::Atom * PROT::Residue::CA () const {
+    if (m_CA < m_count) {return &(m_atoms[m_CA]);}
+    return const_cast<Residue *>(this)->get_atom("CA");
+}
+
+// Whether or not any atom of this Residue could be closer than a distance to
+// any atom of another Residue. When this is false, no pair of their atoms is
+// within the distance, so they do not need to be compared
+bool PROT::Residue::near (const Residue& other, const float distance) const {
+    if ((m_count == 0) || (other.m_count == 0)) {return false;}
+    double reach = distance + m_bounding_radius + other.m_bounding_radius + 1e-3;
+    double squared = 0;
+    for(size_t j=0; j<AtomCoordinates; ++j) {
+        double d = m_centroid[j] - other.m_centroid[j];
+        squared += d * d;}
+    return (squared < reach * reach);
+}
+
+// The coordinates of the Residue's atoms, if they follow each other in a
+// Protein's coordinate buffer
+const PROT::coor * PROT::Residue::coordinates () const {
+    if (m_count == 0) {return 0;}
+    const coor * start = m_atoms[0].m_coors;
+    for(size_t i=1; i<m_count; ++i) {
+        if (m_atoms[i].m_coors != start + AtomCoordinates * i) {return 0;}}
+    return start;
+}
@@ -14,8 +14,10 @@ void PROT::Residue::for_charmm_histidine_fix () {
     if (((m_name == "HIS") || (m_name == "HID")) || ((m_name == "HIE") || (m_name == "HIP"))) {
         m_name = "HSD";
         if (m_count > 0) {
+            Names::ID residue = Names::intern(m_name);
             for(size_t i=0; i<m_count; ++i) {
-                m_atoms[i].m_residue = "HSD";}}}
+                m_atoms[i].set_residue(residue);}}
+        index_atoms();}
 }
 
 // If the Residue's name should be HIS, fix that.
@@ -23,6 +25,8 @@ void PROT::Residue::from_charmm_histidine_fix () {
     if ((m_name == "HSD") || (m_name == "HSE")) {
         m_name = "HIS";
         if (m_count > 0) {
+            Names::ID residue = Names::intern(m_name);
             for(size_t i=0; i<m_count; ++i) {
-                m_atoms[i].m_residue = "HIS";}}}
+                m_atoms[i].set_residue(residue);}}
+        index_atoms();}
 }
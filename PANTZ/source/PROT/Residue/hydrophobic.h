@@ -11,51 +11,14 @@
 
 #include <map>
 
-map<string, vector<string>> polar_atoms_charmm = {
-        {"GLY", {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "N"}},
-        {"ALA", {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "N"}},
-        {"VAL", {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "N"}},
-        {"CYS", {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "N"}},
-        {"PRO", {"O", "C", "OT1", "OT2", "HT1", "HT2", "HT3", "N"}},
-        {"LEU", {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "N"}},
-        {"ILE", {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "N"}},
-        {"MET", {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "N"}},
-        {"TRP", {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "HE1", "N", "NE1"}},
-        {"PHE", {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "N"}},
-        {"SER", {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "OG", "HG", "N"}},
-        {"THR", {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "OG1", "HG1", "N"}},
-        {"TYR", {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "OH", "HH", "N"}},
-        {"ASN", {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "OD1", "HD21", "HD22", "N", "ND2"}},
-        {"GLN", {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "OE1", "HE21", "HE22", "N", "NE2"}},
-        {"LYS", {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "HZ1", "HZ2", "HZ3", "N", "NZ"}},
-        {"ARG", {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "HE", "HH11", "HH12", "HH21", "HH22", "N", "NH1", "NH2", "NE"}},
-        {"HIS", {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "ND1", "HE2", "NE2", "HD1", "N"}},
-        {"HSD", {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "ND1", "HE2", "NE2", "HD1", "N"}},
-        {"ASP", {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "OD1", "OD2", "N"}},
-        {"GLU", {"O", "C", "OT1", "OT2", "HN", "HT1", "HT2", "HT3", "OE1", "OE2", "N"}}
-    };
-
-// bool to determine if the passed atom is polar in this residue
+// bool to determine if the passed atom is polar in this residue. The atom's
+// flags are set from the PolarAtoms table when it is named
 bool is_polar(const PROT::Atom* atom) {
-    // get the residue name
-    string res_name = atom->residue();
-    // get the atom name
-    string atom_name = atom->name();
-    // strip the atom name
-    Text::strip(atom_name);
-    // find the name in polar atoms charmm map map<string, vector<string>> polar_atoms_charmm
-    // if the atom is in the polar atoms map
-    if (find(polar_atoms_charmm.at(res_name).begin(), polar_atoms_charmm.at(res_name).end(), atom_name) != polar_atoms_charmm.at(res_name).end()) {
-        // return true
-        return true;
-    }
-    // }
-    // otherwise return false
-    return false;
+    return atom->is(PROT::Atom::Polar);
 }
 
 // determine the number of hydrophobic interactions between two residues
-vector<PROT::Hydrophobic> PROT::Residue::hydrophobic(PROT::Residue* other, float sasa_cutoff, bool verbose) {
+vector<PROT::Hydrophobic> PROT::Residue::hydrophobic(PROT::Residue* other, float sasa_cutoff, bool verbose, ostream& out) {
     vector<PROT::Hydrophobic> hydrophobic_interactions;
     // this assumes that the phobic sasa points have been set
     // the water probe radius
@@ -456,21 +419,21 @@ vector<PROT::Hydrophobic> PROT::Residue::hydrophobic(PROT::Residue* other, float
         hydrophobic_interactions.push_back(interaction);
     }
     if ((verbose) and (hydrophobic_interactions.size() > 0)) {
-        cout << "Hydrophobic interactions found:\n";
+        out << "Hydrophobic interactions found:\n";
         for (auto & interaction : hydrophobic_interactions) {
-            cout << interaction.res1->m_name << ' ' << interaction.res1->m_number << ' ' << interaction.res1->m_protein << ' ';
+            out << interaction.res1->m_name << ' ' << interaction.res1->m_number << ' ' << interaction.res1->m_protein << ' ';
             if (interaction.res1_backbone) {
-                cout << "bb ";
+                out << "bb ";
             } else {
-                cout << "sc ";
+                out << "sc ";
             }
-            cout << interaction.res2->m_name << ' ' << interaction.res2->m_number << ' ' << interaction.res2->m_protein << ' ';
+            out << interaction.res2->m_name << ' ' << interaction.res2->m_number << ' ' << interaction.res2->m_protein << ' ';
             if (interaction.res2_backbone) {
-                cout << "bb ";
+                out << "bb ";
             } else {
-                cout << "sc ";
+                out << "sc ";
             }
-            cout << interaction.phobic_BSASA << " angstroms^2\n\n";
+            out << interaction.phobic_BSASA << " angstroms^2\n\n";
         }
     }
     return hydrophobic_interactions;
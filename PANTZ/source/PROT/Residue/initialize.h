@@ -24,4 +24,6 @@ void PROT::Residue::initialize () {
     m_phi = -1000.0;
     m_psi = -1000.0;
     m_omega = -1000.0;
+    update_geometry();
+    index_atoms();
 }
@@ -18,7 +18,7 @@ void PROT::Residue::load (const vector<PROT::Atom *>& atoms,
     // If this is a complete load of the Residue's information, extract the
     // meaningful data from the atoms
     if (complete_load) {
-        m_name = atoms[0]->m_residue;
+        m_name = atoms[0]->residue();
         m_number = atoms[0]->m_residue_number;
         m_insertion = atoms[0]->m_insertion;
         m_protein = atoms[0]->m_protein;
@@ -31,9 +31,9 @@ void PROT::Residue::load (const vector<PROT::Atom *>& atoms,
     // If a complete load is not being done and a side chain load is not being
     // done, make sure the provided atoms have the proper residue name
     if ((!complete_load) && (!sidechain_only)) {
-        if (atoms[0]->m_residue != m_name) {
+        if (atoms[0]->residue() != m_name) {
             string error = "It is not permitted to load a "
-                         + atoms[0]->m_residue + " in place of a "
+                         + atoms[0]->residue() + " in place of a "
                          + m_name + ".\n";
             throw PANTZ_error (error);}}
     // The relevant Atoms have to be collected. Store them here
@@ -47,31 +47,32 @@ void PROT::Residue::load (const vector<PROT::Atom *>& atoms,
             throw PANTZ_error (error);}
         // Update the name of the residue to match that from the provided
         // atoms
-        m_name = atoms[0]->m_residue;
+        m_name = atoms[0]->residue();
         // Loop through the current atoms to identify the backbone atoms
         for(size_t i=0; i<m_count; ++i) {
-            if (CHECK::is_backbone_atom(m_atoms[i].m_name)) {
+            const string& atom_name = m_atoms[i].name();
+            if (m_atoms[i].is_backbone_atom()) {
                 // Make sure proper conventions are followed for glycine and
                 // proline
-                if ((m_name == "GLY") && (m_atoms[i].m_name == "HA")) {
-                    m_atoms[i].m_name = "HA2";}
-                else if ((m_name != "GLY") && (m_atoms[i].m_name == "HA2")) {
-                    m_atoms[i].m_name = "HA";}
+                if ((m_name == "GLY") && (atom_name == "HA")) {
+                    m_atoms[i].set_name(Names::intern("HA2"));}
+                else if ((m_name != "GLY") && (atom_name == "HA2")) {
+                    m_atoms[i].set_name(Names::intern("HA"));}
                 else if (m_name == "PRO") {
-                    if (m_atoms[i].m_name == "HN") {continue;}
-                    else if (m_atoms[i].m_name == "HT3") {continue;}
-                    else if (m_atoms[i].m_name == "HT1") {
-                        m_atoms[i].m_name = "HN1";}
-                    else if (m_atoms[i].m_name == "HT2") {
-                        m_atoms[i].m_name = "HN2";}}
-                else if ((m_atoms[i].m_name == "HN1") && (m_name != "PRO")) {
-                    m_atoms[i].m_name = "HT1";}
-                else if ((m_atoms[i].m_name == "HN2") && (m_name != "PRO")) {
-                    m_atoms[i].m_name = "HT2";}
+                    if (atom_name == "HN") {continue;}
+                    else if (atom_name == "HT3") {continue;}
+                    else if (atom_name == "HT1") {
+                        m_atoms[i].set_name(Names::intern("HN1"));}
+                    else if (atom_name == "HT2") {
+                        m_atoms[i].set_name(Names::intern("HN2"));}}
+                else if ((atom_name == "HN1") && (m_name != "PRO")) {
+                    m_atoms[i].set_name(Names::intern("HT1"));}
+                else if ((atom_name == "HN2") && (m_name != "PRO")) {
+                    m_atoms[i].set_name(Names::intern("HT2"));}
                 use.push_back(m_atoms[i]);}}
         // Loop through the provided atoms to identify the non-backbone atoms
         for(size_t i=0; i<atoms.size(); ++i) {
-            if (!CHECK::is_backbone_atom(atoms[i]->m_name)) {
+            if (!atoms[i]->is_backbone_atom()) {
                 use.push_back(*(atoms[i]));}}}
     else {
         for(size_t i=0; i<atoms.size(); ++i) {
@@ -85,12 +86,15 @@ void PROT::Residue::load (const vector<PROT::Atom *>& atoms,
     // Store the chosen atoms
     for(size_t i=0; i<m_count; ++i) {m_atoms[i] = use[i];}
     // Make sure that every atom has the proper labelling information
+    Names::ID residue = Names::intern(m_name);
     for(size_t i=0; i<m_count; ++i) {
         m_atoms[i].m_alt = ' ';
-        m_atoms[i].m_residue = m_name;
+        m_atoms[i].set_residue(residue);
         m_atoms[i].m_residue_number = m_number;
         m_atoms[i].m_insertion = m_insertion;
         m_atoms[i].m_protein = m_protein;}
+    update_geometry();
+    index_atoms();
     // Ensuring consistent Atom numbering is done outside of this function. End
     // the function.
 }
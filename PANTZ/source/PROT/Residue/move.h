@@ -16,6 +16,7 @@ void PROT::Residue::private_move (const Matrix * matrix, const char how) {
     // is a friend of the Atom class, so this is permitted
     if (m_count > 0) {
         for (size_t i=0; i<m_count; ++i){m_atoms[i].private_move(matrix, how);}}
+    update_geometry();
 }
 
 // Move the Residue, but error check the inputs, first
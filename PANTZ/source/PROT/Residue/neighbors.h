@@ -59,4 +59,4 @@ vector<PROT::Residue*> PROT::Residue::get_intra_neighbors(vector<PROT::Residue*>
     // get the neighbors of this residue
     // m_neighbors = tree.radius_neighbors(this, cutoff);
     return tree.radius_neighbors(this, cutoff);
-}
\ No newline at end of file
+}
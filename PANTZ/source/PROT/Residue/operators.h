@@ -36,8 +36,8 @@ PROT::Atom * PROT::Residue::get_atom (const string& label) {
                        "when the Residue is empty.\n";
         throw PANTZ_error (error);}
     // Find the atom
-    for(size_t i=0; i<m_count; ++i) {
-        if (m_atoms[i].m_name == label) {return &(m_atoms[i]);}}
+    PROT::Atom * atom = find_atom(label);
+    if (atom != 0) {return atom;}
     // If there was no such atom
     string error = "This Residue does not contain a " + label + " Atom.\n";
     for (size_t i=0; i<m_count; ++i) {error += m_atoms[i].str();}
@@ -37,5 +37,7 @@ void PROT::Residue::remove_sidechain () {
     m_atoms = m_atoms_new;
     // set the new count
     m_count = bbcount;
+    update_geometry();
+    index_atoms();
     return;
 }
\ No newline at end of file
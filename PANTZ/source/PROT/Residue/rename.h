@@ -13,8 +13,11 @@
 void PROT::Residue::rename(const string& new_name) {
     m_name = new_name;
     // iterate through the atoms and set m_residue to new name
+    Names::ID residue = Names::intern(new_name);
     for (size_t i = 0; i < m_count; i++) {
-        m_atoms[i].m_residue = new_name;
+        m_atoms[i].set_residue(residue);
     }
+    // The Residue may now be a different type
+    index_atoms();
     // return the number of atoms
 }
@@ -17,11 +17,10 @@ float PROT::Residue::rmsd(PROT::Residue* other) {
     vector<PROT::Atom*> other_atoms;
     // go through each set of atoms and add them to the vectors enruing that they are the same order (by name)
     for (size_t i = 0; i < this->size(); i++) {
-        for (size_t j = 0; j < other->size(); j++) {
-            if (this->m_atoms[i].name() == other->m_atoms[j].name()) {
-                atoms.push_back(&this->m_atoms[i]);
-                other_atoms.push_back(&other->m_atoms[j]);
-            }
+        PROT::Atom * match = other->find_atom(this->m_atoms[i].m_name);
+        if (match != 0) {
+            atoms.push_back(&this->m_atoms[i]);
+            other_atoms.push_back(match);
         }
     }
     // Make sure the two residues have the same number of atoms
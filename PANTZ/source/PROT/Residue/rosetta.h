@@ -35,6 +35,9 @@ string PROT::Residue::rosetta_str (long& resNum, long& atomNum,
             m_atoms[i].m_insertion = m_insertion;}
         // Add it's string to the output string
         output.append(m_atoms[i].rosetta_str());}
+    // The atoms' names may have changed
+    update_geometry();
+    index_atoms();
     // If appropriate, increment the residue number
     if (resNum > 0) {resNum++;}
     // Return the string
@@ -46,4 +49,6 @@ void PROT::Residue::update_atoms_after_Rosetta (const bool lastRes) {
     // Use the methods of the atoms
     for(size_t i=0; i<m_count; ++i) {
         m_atoms[i].update_name_after_Rosetta(lastRes);}
+    update_geometry();
+    index_atoms();
 }
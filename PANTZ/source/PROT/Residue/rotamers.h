@@ -17,6 +17,7 @@ using namespace PROT;
 #include <vector>
 #include <string>
 #include <set>
+#include <mutex>
 
 // // map of the number of rotamers for each amino acid
 // map<char, size_t> rotamer_count = {
@@ -93,66 +94,19 @@ using namespace PROT;
 //     m_rotamers = rotamers;
 // }
 
-map<char, vector<vector<string>>> chi_definitions = {
-    {'A', {}},
-    {'R', {{"N", "CA", "CB", "CG"}, {"CA", "CB", "CG", "CD"}, {"CB", "CG", "CD", "NE"}, {"CG", "CD", "NE", "CZ"}}},
-    {'N', {{"N", "CA", "CB", "CG"}, {"CA", "CB", "CG", "OD1"}}},
-    {'D', {{"N", "CA", "CB", "CG"}, {"CA", "CB", "CG", "OD1"}}},
-    {'Q', {{"N", "CA", "CB", "CG"}, {"CA", "CB", "CG", "CD"}, {"CB", "CG", "CD", "OE1"}}},
-    {'E', {{"N", "CA", "CB", "CG"}, {"CA", "CB", "CG", "CD"}, {"CB", "CG", "CD", "OE1"}}},
-    {'G', {}},
-    {'H', {{"N", "CA", "CB", "CG"}, {"CA", "CB", "CG", "ND1"}}},
-    {'K', {{"N", "CA", "CB", "CG"}, {"CA", "CB", "CG", "CD"}, {"CB", "CG", "CD", "CE"}, {"CG", "CD", "CE", "NZ"}}},
-    {'M', {{"N", "CA", "CB", "CG"}, {"CA", "CB", "CG", "SD"}, {"CB", "CG", "SD", "CE"}}},
-    {'F', {{"N", "CA", "CB", "CG"}, {"CA", "CB", "CG", "CD1"}}},
-    {'W', {{"N", "CA", "CB", "CG"}, {"CA", "CB", "CG", "CD1"}}},
-    {'Y', {{"N", "CA", "CB", "CG"}, {"CA", "CB", "CG", "CD1"}}},
-    {'I', {{"N", "CA", "CB", "CG1"}, {"CA", "CB", "CG1", "CD"}}},
-    {'L', {{"N", "CA", "CB", "CG"}, {"CA", "CB", "CG", "CD1"}}},
-    {'P', {{"N", "CA", "CB", "CG"}, {"CA", "CB", "CG", "CD"}, {"CB", "CG", "CD", "HD2"}}},
-    {'S', {{"N", "CA", "CB", "OG"}}},
-    {'T', {{"N", "CA", "CB", "OG1"}}},
-    {'V', {{"N", "CA", "CB", "CG1"}}},
-    {'C', {{"N", "CA", "CB", "SG"}}}
-};
-
-// average phi and psi for 10000 residues from 1000 random pdb files
-map<char, vector<float>> default_dihedrals = {
-    {'A', {-80, 30}},
-    {'R', {-80, 30}},
-    {'N', {-70, 30}},
-    {'D', {-80, 30}},
-    {'Q', {-80, 30}},
-    {'E', {-80, 20}},
-    {'G', {-80, 30}},
-    {'H', {-90, 40}},
-    {'I', {-90, 50}},
-    {'L', {-80, 30}},
-    {'K', {-80, 30}},
-    {'M', {-80, 30}},
-    {'F', {-90, 50}},
-    {'P', {-70, 70}},
-    {'S', {-90, 50}},
-    {'T', {-90, 60}},
-    {'W', {-90, 40}},
-    {'Y', {-90, 50}},
-    {'V', {-90, 60}},
-    {'C', {-90, 60}}
-};
-
 // function to get current chi angles
 vector<float> get_chi_angles(PROT::Residue * res, bool verbose) {
     vector<float> chi_angles;
     // get the chi angles
-    char AA1 = res->AA1();
+    const PROT::ChiAngles& definitions = PROT::ChiDefinitions[res->amino_acid()];
     // chi angle atom definitions
     PROT::Atom* atom1;
     PROT::Atom* atom2;
     PROT::Atom* atom3;
     PROT::Atom* atom4;
-    for (size_t i = 0; i < chi_definitions[AA1].size(); i++) {
+    for (size_t i = 0; i < definitions.count; i++) {
         // get the atom names
-        vector<string> atom_names = chi_definitions[AA1][i];
+        const char * const * atom_names = definitions.atoms[i];
         // get the atoms
         atom1 = res->get_atom(atom_names[0]);
         atom2 = res->get_atom(atom_names[1]);
@@ -171,10 +125,9 @@ vector<float> get_chi_angles(PROT::Residue * res, bool verbose) {
 
 // get the atom index in a residue
 size_t get_atom_index(PROT::Residue * res, string name) {
-    for (size_t i = 0; i < res->size(); i++) {
-        if (res->get_atom(i)->name() == name) {
-            return i;
-        }
+    PROT::Atom * atom = res->find_atom(name);
+    if (atom != 0) {
+        return atom - res->get_atom(0);
     }
     return -999;
 }
@@ -186,7 +139,7 @@ string level_heirarchy = "ABGDEZ";
 set<size_t> get_fixed_atoms(PROT::Residue * res, size_t chi_index) {
     set<size_t> fixed_atoms;
     // get the chi angles
-    char AA1 = res->AA1();
+    const PROT::ChiAngles& definitions = PROT::ChiDefinitions[res->amino_acid()];
     // chi angle atom definitions
     PROT::Atom* atom1;
     PROT::Atom* atom2;
@@ -194,13 +147,13 @@ set<size_t> get_fixed_atoms(PROT::Residue * res, size_t chi_index) {
     PROT::Atom* atom4;
     for (size_t i = 0; i < chi_index+1; i++) {
         // get the atom names
-        vector<string> atom_names = chi_definitions[AA1][i];
+        const char * const * atom_names = definitions.atoms[i];
         // get the atoms
         atom1 = res->get_atom(atom_names[0]);
         atom2 = res->get_atom(atom_names[1]);
         // get the level of the second atom (Beta, Gamma, Delta, Epsilon, etc.)
         // since none of the second atoms have numbers in their names, we can just get the second character
-        string level = atom_names[1].substr(1, 1);
+        string level = string(atom_names[1]).substr(1, 1);
         // cout<<i<<" level: "<<level<<endl;
         // go through the atoms in the residue and fix all atoms up to the level of the second atom (thoose with the same second character or less)
         for (size_t j = 0; j < res->size(); j++) {
@@ -237,19 +190,87 @@ PROT::Residue load_residue(string filename) {
     return residue;
 }
 
+// The atoms of a residue type that each chi angle depends on. These only
+// depend on the names of the residue's atoms, so they are found once for each
+// residue type and shared by every residue and rotamer of that type
+struct RotamerTopology {
+    // the indices of the four atoms that define each chi angle
+    vector<vector<size_t>> chi_atoms;
+    // the indices of the atoms that are moved by rotating each chi angle
+    vector<vector<size_t>> moving;
+};
+
+// get the rotamer topology of a residue, finding it if this is the first
+// residue with its type and atom names
+const RotamerTopology& rotamer_topology(PROT::Residue * res) {
+    static map<string, RotamerTopology> topologies;
+    static mutex lock;
+    char AA1 = res->AA1();
+    string key (1, AA1);
+    for (size_t i = 0; i < res->size(); i++) {
+        key += " " + res->get_atom(i)->name();
+    }
+    lock_guard<mutex> guard (lock);
+    map<string, RotamerTopology>::iterator found = topologies.find(key);
+    if (found != topologies.end()) {
+        return found->second;
+    }
+    RotamerTopology topology;
+    // the backbone atoms are never moved, and each chi angle also fixes the
+    // atoms up to the level of its second atom
+    vector<bool> fixed (res->size(), false);
+    for (size_t j = 0; j < res->size(); j++) {
+        fixed[j] = res->get_atom(j)->is_backbone_atom();
+    }
+    const PROT::ChiAngles& definitions = PROT::ChiDefinitions[res->amino_acid()];
+    for (size_t i = 0; i < definitions.count; i++) {
+        vector<size_t> chi_atoms;
+        for (size_t k = 0; k < 4; k++) {
+            // get_atom throws an error if the residue does not have the atom
+            res->get_atom(definitions.atoms[i][k]);
+            chi_atoms.push_back(get_atom_index(res, definitions.atoms[i][k]));
+        }
+        topology.chi_atoms.push_back(chi_atoms);
+        set<size_t> new_fixed_atoms = get_fixed_atoms(res, i);
+        for (set<size_t>::iterator it = new_fixed_atoms.begin(); it != new_fixed_atoms.end(); ++it) {
+            fixed[*it] = true;
+        }
+        vector<size_t> moving;
+        for (size_t j = 0; j < res->size(); j++) {
+            if (!fixed[j]) {
+                moving.push_back(j);
+            }
+        }
+        topology.moving.push_back(moving);
+    }
+    return topologies[key] = topology;
+}
+
 void PROT::Residue::set_rotamers() {
     // ensure the phi and psi angles of this residue are set
     if (m_phi < -999 || m_psi < -999) {
         string error = "Phi and psi angles must be set before rotamers can be "
                        "generated, call calculate_dihedrals() on the Protein\n";
         // use the default dihedrals for this residue
-        m_phi = default_dihedrals[AA1()][0];
-        m_psi = default_dihedrals[AA1()][1];
+        m_phi = DefaultDihedrals[amino_acid()][0];
+        m_psi = DefaultDihedrals[amino_acid()][1];
     }
     // get the 3 letter name of this residue
     string name = m_name;
     // lowercase the name
     Text::lower(name);
+    // the rotamers start from the coordinates of this residue, which are
+    // used where they are if they are packed together
+    const coor * start = coordinates();
+    vector<coor> copied;
+    if (start == 0) {
+        copied.reserve(m_count * AtomCoordinates);
+        for (size_t i = 0; i < m_count; i++) {
+            copied.insert(copied.end(), m_atoms[i].m_coors, m_atoms[i].m_coors + AtomCoordinates);
+        }
+        start = copied.data();
+    }
+    m_rotamers.clear(m_count);
     // if the residue is alanine or glycine, return
     if (name == "ala") {
         // const string path = string(ROTLIB_PATH) + "/" + name + "_avg_phi_psi_rotamer.pdb";
@@ -259,11 +280,9 @@ void PROT::Residue::set_rotamers() {
         // residue.set_number(m_number, ' ', false);
         // residue.set_number(m_internal, ' ', true);
         // residue.set_protein(m_protein);
-        vector<PROT::Residue> rotamers;
         // rotamers.push_back(residue);
         // add this residue
-        rotamers.push_back(*this);
-        m_rotamers = rotamers;
+        m_rotamers.add(start);
         return;
     } else if (name == "gly") {
         // const string path = string(ROTLIB_PATH) + "/" + name + "_avg_phi_psi_rotamer.pdb";
@@ -276,11 +295,9 @@ void PROT::Residue::set_rotamers() {
         // residue.set_number(m_internal, ' ', true);
         // residue.set_protein(m_protein);
         // cout<<residue.str()<<endl;
-        vector<PROT::Residue> rotamers;
         // rotamers.push_back(residue);
         // add this residue
-        rotamers.push_back(*this);
-        m_rotamers = rotamers;
+        m_rotamers.add(start);
         return;
     } else if (name == "pro") {
         // const string path = string(ROTLIB_PATH) + "/" + name + "_avg_phi_psi_rotamer.pdb";
@@ -290,143 +307,90 @@ void PROT::Residue::set_rotamers() {
         // residue.set_number(m_number, ' ', false);
         // residue.set_number(m_internal, ' ', true);
         // residue.set_protein(m_protein);
-        vector<PROT::Residue> rotamers;
         // rotamers.push_back(residue);
-        rotamers.push_back(*this);
-        m_rotamers = rotamers;
+        m_rotamers.add(start);
         return;
     }
-    // otherwise load the rotamer library file
-    ifstream rotlib(string(PANTZ_PATH) + "/source/external/rotamer_library/ExtendedOpt1-5/" + name + ".bbdep.rotamers.lib");
-    // if the file is not open, throw an error
-    if (!rotlib.is_open()) {
-        string error = "Could not open rotamer library file for residue " + name + "\n";
-        throw PANTZ_error (
-            error
-        );
-    }
-
     // get phi and psi agles rounded to nearest ten
     int phi = round(m_phi/10)*10;
     int psi = round(m_psi/10)*10;
+    // get the chi angles of the rotamers in this phi and psi bin from the
+    // rotamer library, which is read from its file the first time it is used
+    const PROT::RotamerLibrary::Bin library = PROT::RotamerLibrary::rotamers(name, phi, psi);
 
-    // chi angle atom definitions
-    PROT::Atom* atom1;
-    PROT::Atom* atom2;
-    PROT::Atom* atom3;
-    PROT::Atom* atom4;
-    // get the chi angles
-    vector<float> current_chi_angles;
-    char AA1 = this->AA1();
-
-    for (size_t i = 0; i < chi_definitions[AA1].size(); i++) {
-        // get the atom names
-        vector<string> atom_names = chi_definitions[AA1][i];
-        // get the atoms
-        atom1 = get_atom(atom_names[0]);
-        atom2 = get_atom(atom_names[1]);
-        atom3 = get_atom(atom_names[2]);
-        atom4 = get_atom(atom_names[3]);
-        // calculate the dihedral angle
-        float chi = calculate_dihedral(*atom1, *atom2, *atom3, *atom4);
-        // append the chi angle to the list
-        current_chi_angles.push_back(chi);
-    }
-
-    vector<vector<float>> all_chi_angles;
-    // print the lines of this file
-    for (string line; getline(rotlib, line);) {
-        if (line[0] == '#') {
-            continue;
-        }
-        string phi_s = line.substr(5, 5);
-        string psi_s = line.substr(10, 5);
-        // if the second and third element of the line are the phi and psi angles print the line
-        if (stoi(phi_s) == phi && stoi(psi_s) == psi) {
-            // get the chi angles
-            vector<float> chis {stof(line.substr(47, 6)), stof(line.substr(55, 6)), stof(line.substr(63, 6)), stof(line.substr(71, 6))};
-            all_chi_angles.push_back(chis);
-        }
-    }
+    // the atoms that define and are moved by each chi angle
+    const RotamerTopology& topology = rotamer_topology(this);
 
-    // reduce trailing 0's from the chi angles
-    vector<vector<float>> all_chi_angles_reduced;
-    for (vector<float> chi_angles : all_chi_angles) {
-        vector<float> chi_angles_reduced;
-        for (float chi : chi_angles) {
-            if (chi != 0) {
-                chi_angles_reduced.push_back(chi);
-            }
-        }
-        all_chi_angles_reduced.push_back(chi_angles_reduced);
-    }
-
-    // Create a vector to store Rotamer objects
-    vector<PROT::Residue> rotamers;
-    vector<float> new_chi_angles;
+    // the rotamers are stored one after another in a single block
+    m_rotamers.reserve(library.size());
     // Iterate through each set of chi angles
-    for (size_t r = 0; r < all_chi_angles_reduced.size(); ++r) {
+    for (size_t r = 0; r < library.size(); ++r) {
         // Get the chi angles for this rotamer
-        vector<float> chi_angles = all_chi_angles_reduced[r];
-        // Create a new Rotamer object that is a copy of the original residue
-        PROT::Residue rotamer = *this;
-        // get the current chi angles
-        current_chi_angles = get_chi_angles(&rotamer, false);
-        // indices of the atoms to fix
-        set<size_t> fixed_atoms;
-        // add backbone atoms to fixed atoms
-        for (size_t i = 0; i < m_count; i++) {
-            if (rotamer.m_atoms[i].is_backbone_atom()) {
-                fixed_atoms.insert(i);
-            }
-        }
+        vector<float> chi_angles = library[r].chi_angles();
+        // The rotamer starts as a copy of the original residue's coordinates
+        coor * rotamer = m_rotamers.add(start);
         // Apply rotations to the sidechain atoms based on chi angles
         for (size_t i = 0; i < chi_angles.size(); ++i) {
-            // atoms to rotate around
-            vector<string> atom_names = chi_definitions[AA1][i];
-            // get the atoms
-            atom1 = rotamer.get_atom(atom_names[1]);
-            atom2 = rotamer.get_atom(atom_names[2]);
-            // Add atoms before the current rotatable bond to the fixed list
-            set<size_t> new_fixed_atoms = get_fixed_atoms(&rotamer, i);
-            fixed_atoms.insert(new_fixed_atoms.begin(), new_fixed_atoms.end());
+            const vector<size_t>& chi_atoms = topology.chi_atoms.at(i);
+            // the current value of this chi angle, after the earlier chi
+            // angles have been rotated
+            const coor current = calculate_dihedral(rotamer + AtomCoordinates*chi_atoms[0], rotamer + AtomCoordinates*chi_atoms[1],
+                                                    rotamer + AtomCoordinates*chi_atoms[2], rotamer + AtomCoordinates*chi_atoms[3]);
+            // the atoms to rotate around
+            const coor * atom1 = rotamer + AtomCoordinates*chi_atoms[1];
+            const coor * atom2 = rotamer + AtomCoordinates*chi_atoms[2];
             // // angle is the chi angle in radians
-            const coor angle = (chi_angles[i] - current_chi_angles[i]) * M_PI / 180.0f;
+            const coor angle = (chi_angles[i] - current) * M_PI / 180.0f;
             // vector is the bond vector of the atom to rotate around
-            const coor vector[3] = {atom2->m_coors[0] - atom1->m_coors[0], atom2->m_coors[1] - atom1->m_coors[1], atom2->m_coors[2] - atom1->m_coors[2]};
+            const coor vector[3] = {atom2[0] - atom1[0], atom2[1] - atom1[1], atom2[2] - atom1[2]};
             // normalize the vector
             coor norm = sqrt(vector[0]*vector[0] + vector[1]*vector[1] + vector[2]*vector[2]);
             const coor vector_norm[3] = {vector[0]/norm, vector[1]/norm, vector[2]/norm};
             // // Create a matrix for the rotation
             PROT::Matrix rotation_matrix(angle, vector_norm);
-            // Apply rotation to all atoms after the rotation center
-            for (size_t j = 0; j < m_count; ++j) {
-                // dont rotate fixed atoms
-                if (find(fixed_atoms.begin(), fixed_atoms.end(), j) != fixed_atoms.end()) {
-                    // cout<<"fixed atom for chi angle "<<i+1<<": "<<rotamer.m_atoms[j].name()<<endl;
-                    continue;
-                }
+            // Apply rotation to all atoms after the rotatable bond
+            const std::vector<size_t>& moving = topology.moving[i];
+            for (size_t k = 0; k < moving.size(); ++k) {
+                coor * atom = rotamer + AtomCoordinates*moving[k];
                 // translate the atom coordinates to the origin
-                rotamer.m_atoms[j].m_coors[0] -= atom1->m_coors[0];
-                rotamer.m_atoms[j].m_coors[1] -= atom1->m_coors[1];
-                rotamer.m_atoms[j].m_coors[2] -= atom1->m_coors[2];
+                atom[0] -= atom1[0];
+                atom[1] -= atom1[1];
+                atom[2] -= atom1[2];
                 // apply the rotation
-                rotamer.m_atoms[j].rotate(rotation_matrix);
+                rotation_matrix.rotate_coordinates(atom);
                 // translate the atom coordinates back to the original position
-                rotamer.m_atoms[j].m_coors[0] += atom1->m_coors[0];
-                rotamer.m_atoms[j].m_coors[1] += atom1->m_coors[1];
-                rotamer.m_atoms[j].m_coors[2] += atom1->m_coors[2];
+                atom[0] += atom1[0];
+                atom[1] += atom1[1];
+                atom[2] += atom1[2];
             }
-            // reset current chi angles
-            current_chi_angles = get_chi_angles(&rotamer, false);
         }
-        // Add the generated rotamer to the lis t
-        rotamers.push_back(rotamer);
-        // cout<<"final chi angles for rotamer "<<r<<": ";
-        // get_chi_angles(&rotamer, true);
-        // cout<<endl;
-        // break;
     }
-    // Set the rotamers of this residue to the generated rotamers
-    m_rotamers = rotamers;
+}
+
+// make a copy of this residue with the coordinates of one of its rotamers
+PROT::Residue PROT::Residue::rotamer(const size_t i) {
+    return rotamer(m_rotamers, i);
+}
+
+// the same, using rotamers of this residue that are stored somewhere else
+PROT::Residue PROT::Residue::rotamer(const PROT::Rotamers& rotamers, const size_t i) {
+    if (i >= rotamers.size()) {
+        string error = "Rotamer " + to_string(i) + " does not exist for this residue, which has "
+                     + to_string(rotamers.size()) + " rotamers.\n";
+        throw PANTZ_error (error);
+    }
+    if (rotamers.atoms() != m_count) {
+        string error = "The rotamers have " + to_string(rotamers.atoms()) + " atoms, but the "
+                       "residue has " + to_string(m_count) + ".\n";
+        throw PANTZ_error (error);
+    }
+    const coor * coordinates = rotamers[i];
+    PROT::Residue result = *this;
+    for (size_t j = 0; j < m_count; j++) {
+        for (size_t k = 0; k < AtomCoordinates; k++) {
+            result.m_atoms[j].m_coors[k] = coordinates[AtomCoordinates*j + k];
+        }
+    }
+    result.update_geometry();
+    return result;
 }
@@ -15,6 +15,7 @@ void PROT::Residue::private_rotate (const Matrix * matrix) {
     if (m_count > 0) {
         for(size_t i=0; i<m_count; ++i) {
             m_atoms[i].private_rotate(matrix);}}
+    update_geometry();
 }
 
 // The public method does error check the matrix
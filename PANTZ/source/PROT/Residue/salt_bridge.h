@@ -12,7 +12,7 @@
 
 
 // function to find a salt bridge with another residue
-vector<PROT::SaltBridge> PROT::Residue::salt_bridge(PROT::Residue* other, float distance, bool verbose) {
+vector<PROT::SaltBridge> PROT::Residue::salt_bridge(PROT::Residue* other, float distance, bool verbose, ostream& out) {
     // combinations possible are ARG and ASP, ARG and GLU, ARG and c_term,
     // LYS and ASP, LYS and GLU, LYS and c_term, n_term and ASP, n_term and GLU
     // n_term and c_term
@@ -31,7 +31,7 @@ vector<PROT::SaltBridge> PROT::Residue::salt_bridge(PROT::Residue* other, float
     for (size_t i_atom = 0; i_atom < m_count; i_atom++){
         PROT::Atom* atom = &m_atoms[i_atom];
         // Check if the atom is a nitrogen
-        if (atom->m_element == "N") {
+        if (atom->m_element == Names::N) {
             // if this is a backbone nitrogen, and the residue is not a C-terminus, skip
             if (atom->is_backbone_atom() && !m_C_terminus) {
                 continue;
@@ -41,7 +41,7 @@ vector<PROT::SaltBridge> PROT::Residue::salt_bridge(PROT::Residue* other, float
             for (size_t j_atom = 0; j_atom < other->m_count; j_atom++){
                 PROT::Atom* other_atom = &other->m_atoms[j_atom];
                 // Check if the atom is an oxygen or sulfur
-                if (other_atom->m_element == "O" || other_atom->m_element == "S") {
+                if (other_atom->m_element == Names::O || other_atom->m_element == Names::S) {
                     // if this is a backbone oxygen, and the residue is not a N-terminus, skip
                     if (other_atom->is_backbone_atom() && !other->m_N_terminus) {
                         continue;
@@ -50,9 +50,9 @@ vector<PROT::SaltBridge> PROT::Residue::salt_bridge(PROT::Residue* other, float
                     float dist = atom->distance(*other_atom);
                     if (dist < distance) {
                         if (verbose) {
-                            cout << "Salt bridge found with distance: "<<dist<<"\n";
-                            cout << atom->str();
-                            cout << other_atom->str()<<"\n";
+                            out << "Salt bridge found with distance: "<<dist<<"\n";
+                            out << atom->str();
+                            out << other_atom->str()<<"\n";
                         }
                         PROT::SaltBridge salt_bridge;
                         salt_bridge.donor_residue = this;
@@ -73,7 +73,7 @@ vector<PROT::SaltBridge> PROT::Residue::salt_bridge(PROT::Residue* other, float
     for (size_t j_atom = 0; j_atom < other->m_count; j_atom++){
         PROT::Atom * other_atom = &other->m_atoms[j_atom];
         // Check if the atom is a nitrogen
-        if (other_atom->m_element == "N") {
+        if (other_atom->m_element == Names::N) {
             // if this is a backbone nitrogen, and the residue is not a C-terminus, skip
             if (other_atom->is_backbone_atom() && !other->m_C_terminus) {
                 continue;
@@ -83,7 +83,7 @@ vector<PROT::SaltBridge> PROT::Residue::salt_bridge(PROT::Residue* other, float
             for (size_t i_atom = 0; i_atom < m_count; i_atom++){
                 PROT::Atom * atom = &m_atoms[i_atom];
                 // Check if the atom is an oxygen or sulfur
-                if (atom->m_element == "O" || atom->m_element == "S") {
+                if (atom->m_element == Names::O || atom->m_element == Names::S) {
                     // if this is a backbone oxygen, and the residue is not a N-terminus, skip
                     if (atom->is_backbone_atom() && !m_N_terminus) {
                         continue;
@@ -92,9 +92,9 @@ vector<PROT::SaltBridge> PROT::Residue::salt_bridge(PROT::Residue* other, float
                     float dist = other_atom->distance(*atom);
                     if (dist < distance) {
                         if (verbose) {
-                            cout << "Salt bridge found with distance: "<<dist<<"\n";
-                            cout << atom->str();
-                            cout << other_atom->str()<<"\n";
+                            out << "Salt bridge found with distance: "<<dist<<"\n";
+                            out << atom->str();
+                            out << other_atom->str()<<"\n";
                         }
                         PROT::SaltBridge salt_bridge;
                         salt_bridge.donor_residue = other;
@@ -9,76 +9,68 @@
 #error Methods of the Residue class must be loaded from the Residue.h header file
 #endif
 
-// Select a set of Atoms from the Residue
-void PROT::Residue::select_atoms (vector<Atom *>& chosen, 
-                                  const string how = "all") {
+// The strings that describe each way of selecting Atoms, in the order of the
+// Selection enum
+const char * const ResidueSelectionNames [] = {"all", "heavy", "sidechain all",
+    "sidechain heavy", "backbone all", "backbone heavy", "backbone main", "CA",
+    "rotamer"};
+
+// Get the selection that a string describes
+PROT::Residue::Selection PROT::Residue::selection (const string& how) {
     // Make a copy of the provided selection string that's not a const
     string assess = how;
     // Make sure it is all lower case letters
     Text::lower(assess);
-    // Convert the string to an integer method counter
-    int method = 0;
-    if (assess == "all") {method = 1;}
-    else if (assess == "heavy") {method = 2;}
-    else if (assess == "sidechain all") {method = 3;}
-    else if (assess == "sidechain heavy") {method = 4;}
-    else if (assess == "backbone all") {method = 5;}
-    else if (assess == "backbone heavy") {method = 6;}
-    else if (assess == "backbone main") {method = 7;}
-    else if (assess == "CA") {method = 8;}
-    else if (assess == "rotamer") {method = 9;}
-    else {
-        string error = how + " is not a recognized atom selection criteria.\n";
-        throw PANTZ_error (error);}
+    // Compare it to the lower case version of each selection's name
+    for(size_t i=0; i<=SelectRotamer; ++i) {
+        string name = ResidueSelectionNames[i];
+        Text::lower(name);
+        if (assess == name) {return static_cast<Selection>(i);}}
+    string error = how + " is not a recognized atom selection criteria.\n";
+    throw PANTZ_error (error);
+}
+
+// Select a set of Atoms from the Residue
+void PROT::Residue::select_atoms (vector<Atom *>& chosen,
+                                  const Selection method) {
     // if the Residue is empty, be done
     if (m_count == 0) {return;}
     // Implement the first two methods, which apply to any residue
-    if (method == 1) {
+    if (method == SelectAll) {
         for(size_t i=0; i<m_count; ++i) {chosen.push_back(&(m_atoms[i]));}
         return;}
-    if (method == 2) {
+    if (method == SelectHeavy) {
         for(size_t i=0; i<m_count; ++i) {
-            if (!m_atoms[i].is_hydrogen()) {chosen.push_back(&(m_atoms[i]));}}
+            if (!m_atoms[i].is(Atom::Hydrogen)) {chosen.push_back(&(m_atoms[i]));}}
         return;}
     // The remaining methods only apply to amino acids, so error check that
     if (!is_amino_acid()) {
-        string error = m_name + " is not an amino acid, so " + how + " is not "
-                     "a valid atom selection criteria.\n";
+        string error = m_name + " is not an amino acid, so "
+                     + ResidueSelectionNames[method] + " is not a valid atom "
+                     "selection criteria.\n";
         throw PANTZ_error (error);}
-    // Side chain methods
-    if (method == 3) {
+    // Side chain and backbone methods, based on all atoms or only heavy atoms
+    if ((method == SelectSidechain) || (method == SelectSidechainHeavy) ||
+        (method == SelectBackbone) || (method == SelectBackboneHeavy)) {
+        bool backbone = ((method == SelectBackbone) || (method == SelectBackboneHeavy));
+        bool heavy = ((method == SelectSidechainHeavy) || (method == SelectBackboneHeavy));
         for(size_t i=0; i<m_count; ++i) {
-            if (!m_atoms[i].is_backbone_atom()) {
-                chosen.push_back(&(m_atoms[i]));}}
-        return;}
-    if (method == 4) {
-        for (size_t i=0; i<m_count; ++i) {
-            if ((!m_atoms[i].is_backbone_atom()) && (!m_atoms[i].is_hydrogen())) {
-                chosen.push_back(&(m_atoms[i]));}}
-        return;}
-    // Backbone methods based on all atoms or only heavy atoms
-    if (method == 5) {
-        for (size_t i=0; i<m_count; ++i) {
-            if (m_atoms[i].is_backbone_atom()) {
-                chosen.push_back(&(m_atoms[i]));}}
-        return;}
-    if (method == 6) {
-        for (size_t i=0; i<m_count; ++i) {
-            if ((m_atoms[i].is_backbone_atom()) && (!m_atoms[i].is_hydrogen())) {
+            if ((m_atoms[i].is(Atom::Backbone) == backbone) &&
+                ((!heavy) || (!m_atoms[i].is(Atom::Hydrogen)))) {
                 chosen.push_back(&(m_atoms[i]));}}
         return;}
     // Access specific atom lists. These methods require all of the atoms to be
     // present.
     try {
-        if (method == 7) {
+        if (method == SelectBackboneMain) {
             chosen.push_back(get_atom("N"));
             chosen.push_back(get_atom("CA"));
             chosen.push_back(get_atom("C"));
             return;}
-        if (method == 8) {
+        if (method == SelectCA) {
             chosen.push_back(get_atom("CA"));
             return;}
-        if (method == 9) {
+        if (method == SelectRotamer) {
             chosen.push_back(get_atom("CA"));
             chosen.push_back(get_atom("N"));
             if (m_name == "GLY") {chosen.push_back(get_atom("HA1"));}
@@ -89,6 +81,13 @@ void PROT::Residue::select_atoms (vector<Atom *>& chosen,
         throw PANTZ_error (e, error);}
 }
 
+// Select a set of Atoms from the Residue with a string that describes the
+// selection
+void PROT::Residue::select_atoms (vector<Atom *>& chosen,
+                                  const string how = "all") {
+    select_atoms(chosen, selection(how));
+}
+
 // Another version of the function that works with AtomPtr objects instead of
 // pointers to Atoms
 void PROT::Residue::select_atoms (vector<AtomPtr>& atoms, 
@@ -103,6 +102,12 @@ void PROT::Residue::select_atoms (vector<AtomPtr>& atoms,
 }
 
 // Equivalent functions in the ResiduePtr class
+void PROT::ResiduePtr::select_atoms (vector<Atom *>& atoms,
+                                     const Residue::Selection how) {
+    check ();
+    m_ptr->select_atoms(atoms, how);
+}
+
 void PROT::ResiduePtr::select_atoms (vector<Atom *>& atoms,
                                      const string how = "all") {
     check ();
@@ -0,0 +1,131 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file is intended to be loaded directly from the Residue.h header file,
+ * and has preprocessor directives to control that behavior. It contains the
+ * methods that find a Residue's Atoms by their names. Each standard amino acid
+ * has a fixed list of the atoms it can have, and a Residue remembers where
+ * each of those atoms is in its array, so finding one of them does not
+ * require searching through the Residue. Atoms that are not in the lists, and
+ * the Atoms of Residues that are not standard amino acids, are still found by
+ * searching. */
+
+// Make sure that the Residue class is currently loading methods
+#ifndef Residue_Loading_Status
+#error Methods of the Residue class must be loaded from the Residue.h header file
+#endif
+
+// The atoms of each standard amino acid. The backbone and terminal atoms are
+// the same in every amino acid and come first, followed by the side chain atoms
+// of each amino acid in CHARMM naming, in the order of the AminoAcid enum
+const char * const ResidueSlotBackbone = "N HN CA HA C O HT1 HT2 HT3 OT1 OT2 OXT HA1 HA2 HN1 HN2";
+const char * const ResidueSlotSidechains [PROT::StandardAminoAcids] = {
+    "CB HB1 HB2 HB3",
+    "CB HB1 HB2 SG HG1",
+    "CB HB1 HB2 CG OD1 OD2",
+    "CB HB1 HB2 CG HG1 HG2 CD OE1 OE2",
+    "CB HB1 HB2 CG CD1 HD1 CE1 HE1 CZ HZ CD2 HD2 CE2 HE2",
+    "",
+    "CB HB1 HB2 ND1 HD1 CG CE1 HE1 NE2 HE2 CD2 HD2",
+    "CB HB CG2 HG21 HG22 HG23 CG1 HG11 HG12 CD HD1 HD2 HD3 CD1 HD11 HD12 HD13",
+    "CB HB1 HB2 CG HG1 HG2 CD HD1 HD2 CE HE1 HE2 NZ HZ1 HZ2 HZ3",
+    "CB HB1 HB2 CG HG CD1 HD11 HD12 HD13 CD2 HD21 HD22 HD23",
+    "CB HB1 HB2 CG HG1 HG2 SD CE HE1 HE2 HE3",
+    "CB HB1 HB2 CG OD1 ND2 HD21 HD22",
+    "CB HB1 HB2 CG HG1 HG2 CD HD1 HD2",
+    "CB HB1 HB2 CG HG1 HG2 CD OE1 NE2 HE21 HE22",
+    "CB HB1 HB2 CG HG1 HG2 CD HD1 HD2 NE HE CZ NH1 HH11 HH12 NH2 HH21 HH22",
+    "CB HB1 HB2 OG HG1",
+    "CB HB OG1 HG1 CG2 HG21 HG22 HG23",
+    "CB HB CG1 HG11 HG12 HG13 CG2 HG21 HG22 HG23",
+    "CB HB1 HB2 CG CD1 HD1 NE1 HE1 CE2 CD2 CE3 HE3 CZ3 HZ3 CZ2 HZ2 CH2 HH2",
+    "CB HB1 HB2 CG CD1 HD1 CE1 HE1 CZ OH HH CD2 HD2 CE2 HE2"};
+
+// The tables of slots for every standard amino acid
+struct PROT::Residue::SlotTable {
+    // For each amino acid, the slot of each atom name, by name and by ID (-1
+    // if the amino acid does not have an atom with that name)
+    vector<unordered_map<string, uint8_t> > by_name;
+    vector<vector<int8_t> > by_id;
+    // For each amino acid, the ID of the atom name in each slot
+    vector<vector<Names::ID> > ids;
+    // Build the tables
+    SlotTable ();
+};
+
+// Build the tables from the lists of atom names
+PROT::Residue::SlotTable::SlotTable () {
+    by_name.resize(StandardAminoAcids);
+    by_id.resize(StandardAminoAcids);
+    ids.resize(StandardAminoAcids);
+    vector<string> backbone = Text::split(ResidueSlotBackbone, ' ');
+    for(size_t t=0; t<StandardAminoAcids; ++t) {
+        vector<string> names = backbone;
+        vector<string> sidechain = Text::split(ResidueSlotSidechains[t], ' ');
+        names.insert(names.end(), sidechain.begin(), sidechain.end());
+        if (names.size() > AtomSlots) {
+            string error = AA3[t] + " has more atoms than a Residue has slots "
+                           "for.\n";
+            throw PANTZ_error (error);}
+        for(size_t i=0; i<names.size(); ++i) {
+            Names::ID id = Names::intern(names[i]);
+            by_name[t][names[i]] = i;
+            if (by_id[t].size() <= id) {by_id[t].resize(id + 1, -1);}
+            by_id[t][id] = i;
+            ids[t].push_back(id);}}
+}
+
+// The tables are built once, by whichever thread needs them first
+const PROT::Residue::SlotTable& PROT::Residue::slot_table () {
+    static const SlotTable table;
+    return table;
+}
+
+// Work out which standard amino acid the Residue is and where each of its
+// atoms is. When a name is used by more than one Atom, the first one is used,
+// the same as searching the Residue would find
+void PROT::Residue::index_atoms () {
+    for(size_t i=0; i<AtomSlots; ++i) {m_slots[i] = 0;}
+    AminoAcid amino = PROT::amino_acid(m_name);
+    m_type = (amino == NotAminoAcid) ? -1 : standard(amino);
+    if (m_type < 0) {return;}
+    const SlotTable& table = slot_table();
+    const vector<int8_t>& slots = table.by_id[m_type];
+    for(size_t i=0; (i<m_count) && (i<255); ++i) {
+        Names::ID id = m_atoms[i].m_name;
+        if ((id < slots.size()) && (slots[id] >= 0) && (m_slots[slots[id]] == 0)) {
+            m_slots[slots[id]] = i + 1;}}
+}
+
+// The Atom in a slot, if it is there and still has the slot's name
+PROT::Atom * PROT::Residue::slot_atom (const size_t slot) {
+    size_t i = m_slots[slot];
+    if ((i == 0) || (i > m_count)) {return 0;}
+    PROT::Atom * atom = &(m_atoms[i-1]);
+    if (atom->m_name != slot_table().ids[m_type][slot]) {return 0;}
+    return atom;
+}
+
+// Find an Atom by the ID of its name, or return 0 if there is no such Atom
+PROT::Atom * PROT::Residue::find_atom (const Names::ID id) {
+    if (m_type >= 0) {
+        const vector<int8_t>& slots = slot_table().by_id[m_type];
+        if ((id < slots.size()) && (slots[id] >= 0)) {
+            PROT::Atom * atom = slot_atom(slots[id]);
+            if (atom != 0) {return atom;}}}
+    for(size_t i=0; i<m_count; ++i) {
+        if (m_atoms[i].m_name == id) {return &(m_atoms[i]);}}
+    return 0;
+}
+
+// Find an Atom by its name, or return 0 if there is no such Atom
+PROT::Atom * PROT::Residue::find_atom (const string& label) {
+    if (m_type >= 0) {
+        const unordered_map<string, uint8_t>& slots = slot_table().by_name[m_type];
+        unordered_map<string, uint8_t>::const_iterator it = slots.find(label);
+        if (it != slots.end()) {
+            PROT::Atom * atom = slot_atom(it->second);
+            if (atom != 0) {return atom;}}}
+    for(size_t i=0; i<m_count; ++i) {
+        if (m_atoms[i].name() == label) {return &(m_atoms[i]);}}
+    return 0;
+}
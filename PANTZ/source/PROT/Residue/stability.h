@@ -12,14 +12,34 @@
 #endif
 
 #include "../Protein.h"
+#include "../PackedAtoms.h"
 
-size_t PROT::Residue::free_rotamers(vector<PROT::Residue> rotamers, vector<PROT::Residue*> neighbors) {
+size_t PROT::Residue::free_rotamers(const PROT::Rotamers& rotamers, const vector<PROT::Residue*>& neighbors) {
+    // the rotamers must have this residue's atoms
+    if ((rotamers.size() > 0) && (rotamers.atoms() != m_count)) {
+        string error = "The rotamers have " + to_string(rotamers.atoms()) + " atoms, but the "
+                       "residue has " + to_string(m_count) + ".\n";
+        throw PANTZ_error (error);
+    }
+    // pack the heavy atoms of every neighbor once
+    vector<PROT::PackedAtoms> packed_neighbors (neighbors.size());
+    for (size_t j = 0; j < neighbors.size(); j++) {
+        packed_neighbors[j].load(neighbors[j], false);
+    }
     // count the clashes with the neighbors
     size_t count = 0;
+    PROT::PackedAtoms side_chain;
+    PROT::Residue rotamer;
     for (size_t i = 0; i < rotamers.size(); i++) {
+        side_chain.load(this, rotamers[i], true);
+        // an element without a known radius is checked atom by atom, which
+        // needs the rotamer's own atoms
+        if (!side_chain.known()) {
+            rotamer = this->rotamer(rotamers, i);
+            side_chain.load(&rotamer, true);
+        }
         for (size_t j = 0; j < neighbors.size(); j++) {
-            if (rotamers[i].heavy_side_chain_clash(neighbors[j])) {
-            // if (rotamers[i].heavy_clash(neighbors[j])) {
+            if (side_chain.clash(packed_neighbors[j])) {
                 count++;
                 // skip to the next rotamer
                 break;
@@ -30,26 +50,21 @@ size_t PROT::Residue::free_rotamers(vector<PROT::Residue> rotamers, vector<PROT:
     return rotamers.size() - count;
 }
 
-// function to check the stability of the residue in its environment
-void PROT::Residue::set_stability(vector<PROT::Residue> rotamers, vector<PROT::Residue*> neighbors, bool backbone, string& how) {
+// function to determine the stability of the residue in its environment. This
+// does not change the residue, so several threads may call it at once
+bool PROT::Residue::stable(const PROT::Rotamers& rotamers, vector<PROT::Residue*>& neighbors, bool backbone) {
+    return stable(rotamers.size(), free_rotamers(rotamers, neighbors), neighbors, backbone);
+}
+
+// the same check when the number of rotamers and how many of them are free of
+// clashes with the neighbors are already known
+bool PROT::Residue::stable(const size_t rotamers, const size_t free_rot, vector<PROT::Residue*>& neighbors, bool backbone) {
     // if backbone set to true
     if (backbone) {
-        if (how == "pre") {
-            m_prestable = true;
-        }
-        else {
-            m_bound_stable = true;
-        }
-        return;
+        return true;
     }
     if (m_name == "GLY" || m_name == "ALA" || m_name == "PRO") {
-        if (how == "pre") {
-            m_prestable = true;
-        }
-        else {
-            m_bound_stable = true;
-        }
-        return;
+        return true;
     }
     bool salt_bridge_possible = false;
     size_t sb_count = 0;
@@ -63,6 +78,10 @@ void PROT::Residue::set_stability(vector<PROT::Residue> rotamers, vector<PROT::R
     if (salt_bridge_possible) {
         vector<PROT::SaltBridge> salt_bridges;
         for (size_t i = 0; i < neighbors.size(); i++) {
+            // neighbors whose atoms are all too far away can be skipped
+            if (!near(*neighbors[i], 4.0)) {
+                continue;
+            }
             salt_bridges = this->salt_bridge(neighbors[i], 4.0, false);
             if (salt_bridges.size() > 0) {
                 sb_count += salt_bridges.size();
@@ -70,40 +89,15 @@ void PROT::Residue::set_stability(vector<PROT::Residue> rotamers, vector<PROT::R
         }
         // if sb > 1 set to prestable and stop checking
         if (sb_count > 1) {
-            if (how == "pre") {
-                m_prestable = true;
-            }
-            else {
-                m_bound_stable = true;
-            }
-            return;
+            return true;
         }
     }
-    // get the number of free rotamers
-    size_t free_rot = free_rotamers(rotamers, neighbors);
     // check if prestable
-    if ((rotamers.size() - free_rot) > 0.8*rotamers.size()) {
-        if (how == "pre") {
-            m_prestable = true;
-        }
-        else {
-            m_bound_stable = true;
-        }
+    if ((rotamers - free_rot) > 0.8*rotamers) {
+        return true;
     }
     else if ((m_name == "SER" || m_name == "THR" || m_name == "CYS" || m_name == "VAL") and free_rot < 3) {
-        if (how == "pre") {
-            m_prestable = true;
-        }
-        else {
-            m_bound_stable = true;
-        }
-    }
-    else {
-        if (how == "pre") {
-            m_prestable = false;
-        }
-        else {
-            m_bound_stable = false;
-        }
+        return true;
     }
+    return false;
 }
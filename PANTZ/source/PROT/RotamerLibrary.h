@@ -0,0 +1,141 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file contains the declaration of the RotamerLibrary class. It holds the
+ * backbone dependent rotamer libraries in memory, indexed by residue type and
+ * (phi, psi) bin, so that each library file is only read once by a program.
+ * The libraries can also be compiled into a single binary file of fixed width
+ * records. When that file exists it is mapped into memory instead of reading
+ * the text files, so every program running on a computer shares one copy of it.
+ * A residue whose text file has changed since the binary file was compiled is
+ * read from its text file instead.
+ * This file also includes the header files where the methods of the class are
+ * implemented. */
+
+// Use a header guard to make sure this file is only included in a compiled
+// program a single time
+#ifndef Proteins_RotamerLibrary_Guard
+#define Proteins_RotamerLibrary_Guard 1
+
+// Make sure this file is being included from the Proteins.h header file
+#ifndef Proteins_Loading_Status
+#error RotamerLibrary.h must be included by Proteins.h
+#endif
+
+// The libraries are loaded the first time they are needed, which may be by
+// several threads at once
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <map>
+#include <mutex>
+
+// Define the RotamerLibrary class. Everything in it is static, so there is one
+// copy of the libraries for the whole program
+class PROT::RotamerLibrary {
+
+    // The public interface of the class
+    public:
+        // One line of a rotamer library. This is also exactly how a rotamer is
+        // stored in the binary file, so its size must not change
+        struct Rotamer {
+            // The mean and standard deviation of each chi angle
+            float chi[4];
+            float sigma[4];
+            // The probability of the rotamer in its (phi, psi) bin
+            float probability;
+            // The rotamer bin of each chi angle
+            unsigned char r[4];
+            // The chi angles that are not 0
+            vector<float> chi_angles () const;
+        };
+        // The rotamers of a residue type in one (phi, psi) bin
+        struct Bin {
+            const Rotamer * first;
+            size_t count;
+            size_t size () const {return count;}
+            const Rotamer& operator[] (const size_t i) const {return first[i];}
+        };
+        // The libraries have bins every 10 degrees from -180 to 180 for both phi
+        // and psi
+        static const int Bins = 37;
+        // The index of the bin of a pair of phi and psi angles (which must
+        // already be rounded to a multiple of 10)
+        static size_t bin (const int, const int);
+        // The folder that contains the libraries
+        static string directory ();
+        // The file that contains the library of a residue type, which is given
+        // by its lowercase three letter name
+        static string file (const string&);
+        // The binary file of compiled libraries
+        static string binary_file ();
+        // The rotamers of a residue type in a (phi, psi) bin
+        static Bin rotamers (const string&, const int, const int);
+        // Compile the text libraries of the listed residue types into a binary
+        // file
+        static void compile (const vector<string>&, const string&);
+
+    // The information stored in the class is private
+    private:
+        // The start of the binary file. The size and hash of each residue's
+        // text file, the residue names (4 characters each), the bin offsets of
+        // each residue and then the rotamers follow it
+        struct Header {
+            char magic[8];
+            uint32_t version;
+            uint32_t types;
+            uint32_t bins;
+            uint32_t records;
+        };
+        // A binary file that has been mapped into memory
+        struct Mapping {
+            const char * data;
+            size_t bytes;
+            const Header * header;
+            const uint64_t * sources;
+            const char * names;
+            const uint32_t * offsets;
+            const Rotamer * records;
+        };
+        // The rotamers of one residue type. The rotamers of bin i are records
+        // offsets[i] up to (but not including) offsets[i+1], in the order that
+        // they appear in the text file. They either point into the binary file
+        // or into the vectors that were read from the text file
+        struct Table {
+            once_flag loaded;
+            vector<Rotamer> owned_records;
+            vector<uint32_t> owned_offsets;
+            const Rotamer * records;
+            const uint32_t * offsets;
+        };
+        // Get the table of a residue type, which may not be loaded yet
+        static Table& table (const string&);
+        // Load a table, from the binary file if it holds the residue type and
+        // from the text file if it does not
+        static void load (const string&, Table&);
+        // Read a library text file into a table
+        static void read (const string&, Table&);
+        // Whether or not a residue's text file still has the size and hash it
+        // had when the binary file was compiled
+        static bool current (const string&, const uint64_t *);
+        // The binary file, mapped into memory the first time it is needed. If
+        // the file does not exist, the mapping holds no data
+        static const Mapping& mapping ();
+        static Mapping map_file (const string&);
+
+    // End the class definition
+};
+
+// Define a preprocessor variable to guarantee that the RotamerLibrary methods
+// are included here and only here
+#define RotamerLibrary_Loading_Status 1
+
+// Include the files that implement class methods
+#include "RotamerLibrary/load.h"
+#include "RotamerLibrary/binary.h"
+#include "RotamerLibrary/rotamers.h"
+
+// Undefine the loading status variable
+#undef RotamerLibrary_Loading_Status
+
+// End the header guard from the start of the file
+#endif
@@ -0,0 +1,143 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file is intended to be included by the RotamerLibrary.h header file. It
+ * implements the functions that write and map the binary rotamer library file.
+ * The file is written in the byte order of the computer that compiled it, so
+ * it should be compiled on the computer where it is used. */
+
+// Confirm that the RotamerLibrary class is loading the content
+#ifndef RotamerLibrary_Loading_Status
+#error RotamerLibrary methods must be included by RotamerLibrary.h
+#endif
+
+// Include the POSIX files used to map a file into memory
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// The label at the start of the binary file and its format version
+static const char RotamerLibraryMagic[8] = {'P', 'A', 'N', 'T', 'Z', 'R', 'O', 'T'};
+static const uint32_t RotamerLibraryVersion = 2;
+
+// The binary file of compiled libraries
+string PROT::RotamerLibrary::binary_file () {
+    return directory() + "bbdep.rotamers.bin";
+}
+
+// Map a binary file into memory and find where each part of it starts
+PROT::RotamerLibrary::Mapping PROT::RotamerLibrary::map_file (const string& fileName) {
+    Mapping result = {nullptr, 0, nullptr, nullptr, nullptr, nullptr, nullptr};
+    int descriptor = open(fileName.c_str(), O_RDONLY);
+    // It is fine for there to be no binary file
+    if (descriptor < 0) {return result;}
+    struct stat information;
+    if (fstat(descriptor, &information) != 0) {
+        close(descriptor);
+        string error = "Could not read the size of " + fileName + "\n";
+        throw PANTZ_error (error);}
+    size_t bytes = information.st_size;
+    void * data = nullptr;
+    if (bytes >= sizeof(Header)) {
+        data = mmap(nullptr, bytes, PROT_READ, MAP_SHARED, descriptor, 0);}
+    // The mapping stays valid after the file is closed
+    close(descriptor);
+    if ((data == nullptr) || (data == MAP_FAILED)) {
+        string error = "Could not map the rotamer library file " + fileName + "\n";
+        throw PANTZ_error (error);}
+    result.data = static_cast<const char *>(data);
+    result.bytes = bytes;
+    result.header = reinterpret_cast<const Header *>(result.data);
+    // Make sure the file was written by this version of the code and holds as
+    // much information as it says it does
+    const Header& header = *result.header;
+    size_t names = sizeof(Header) + 2 * sizeof(uint64_t) * header.types;
+    size_t start = names + 4 * header.types;
+    size_t rotamers = start + sizeof(uint32_t) * header.types * (header.bins + 1);
+    bool valid = ((memcmp(header.magic, RotamerLibraryMagic, 8) == 0) &&
+                  (header.version == RotamerLibraryVersion) &&
+                  (header.bins == Bins * Bins) &&
+                  (bytes == rotamers + sizeof(Rotamer) * header.records));
+    // Each residue's offsets must stay within the rotamers
+    const uint32_t * offsets = reinterpret_cast<const uint32_t *>(result.data + start);
+    for (size_t i = 0; (valid) && (i < header.types); i++) {
+        const uint32_t * offset = offsets + i * (header.bins + 1);
+        for (size_t j = 0; (valid) && (j <= header.bins); j++) {
+            valid = ((offset[j] <= header.records) &&
+                     ((j == 0) || (offset[j-1] <= offset[j])));}}
+    if (!valid) {
+        munmap(data, bytes);
+        string error = fileName + " is not a valid compiled rotamer library. "
+                       "Compile it again from the text files.\n";
+        throw PANTZ_error (error);}
+    result.sources = reinterpret_cast<const uint64_t *>(result.data + sizeof(Header));
+    result.names = result.data + names;
+    result.offsets = offsets;
+    result.records = reinterpret_cast<const Rotamer *>(result.data + rotamers);
+    return result;
+}
+
+// The binary file is mapped the first time it is needed and stays mapped for
+// the rest of the program
+const PROT::RotamerLibrary::Mapping& PROT::RotamerLibrary::mapping () {
+    static const Mapping binary = map_file(binary_file());
+    return binary;
+}
+
+// Whether or not a residue's text file is the one the binary file was compiled
+// from. If the text file is gone, the binary file is all there is to use
+bool PROT::RotamerLibrary::current (const string& name, const uint64_t * source) {
+    MappedFile text;
+    if (!text.open(file(name))) {return true;}
+    return ((text.size() == source[0]) && (text.hash() == source[1]));
+}
+
+// Compile the text libraries of the listed residue types into a binary file
+void PROT::RotamerLibrary::compile (const vector<string>& names, const string& fileName) {
+    // The offsets of the different residue types all index the same list of
+    // rotamers
+    vector<Rotamer> records;
+    vector<uint32_t> offsets;
+    vector<uint64_t> sources;
+    for(size_t i=0; i<names.size(); ++i) {
+        if (names[i].size() > 3) {
+            string error = names[i] + " is not a three letter residue name\n";
+            throw PANTZ_error (error);}
+        // Record which text file the residue's rotamers come from
+        MappedFile text;
+        if (!text.open(file(names[i]))) {
+            string error = "Could not open rotamer library file for residue " + names[i] + "\n";
+            throw PANTZ_error (error);}
+        sources.push_back(text.size());
+        sources.push_back(text.hash());
+        Table library;
+        read(names[i], library);
+        for(size_t j=0; j<library.owned_offsets.size(); ++j) {
+            offsets.push_back(records.size() + library.owned_offsets[j]);}
+        records.insert(records.end(), library.owned_records.begin(),
+                       library.owned_records.end());}
+    Header header;
+    memcpy(header.magic, RotamerLibraryMagic, 8);
+    header.version = RotamerLibraryVersion;
+    header.types = names.size();
+    header.bins = Bins * Bins;
+    header.records = records.size();
+    ofstream output (fileName.c_str(), ios::binary);
+    if (!output.is_open()) {
+        string error = "Could not open " + fileName + " for writing\n";
+        throw PANTZ_error (error);}
+    output.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+    output.write(reinterpret_cast<const char *>(sources.data()),
+                 sizeof(uint64_t) * sources.size());
+    for(size_t i=0; i<names.size(); ++i) {
+        char name[4] = {0, 0, 0, 0};
+        memcpy(name, names[i].c_str(), names[i].size());
+        output.write(name, 4);}
+    output.write(reinterpret_cast<const char *>(offsets.data()),
+                 sizeof(uint32_t) * offsets.size());
+    output.write(reinterpret_cast<const char *>(records.data()),
+                 sizeof(Rotamer) * records.size());
+    if (!output.good()) {
+        string error = "Could not write " + fileName + "\n";
+        throw PANTZ_error (error);}
+}
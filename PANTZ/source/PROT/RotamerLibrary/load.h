@@ -0,0 +1,99 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file is intended to be included by the RotamerLibrary.h header file. It
+ * implements the functions that read the rotamer library text files. */
+
+// Confirm that the RotamerLibrary class is loading the content
+#ifndef RotamerLibrary_Loading_Status
+#error RotamerLibrary methods must be included by RotamerLibrary.h
+#endif
+
+// The folder that contains the libraries
+string PROT::RotamerLibrary::directory () {
+    return string(PANTZ_PATH) + "/source/external/rotamer_library/ExtendedOpt1-5/";
+}
+
+// The file that contains the library of a residue type
+string PROT::RotamerLibrary::file (const string& name) {
+    return directory() + name + ".bbdep.rotamers.lib";
+}
+
+// The index of a (phi, psi) bin
+size_t PROT::RotamerLibrary::bin (const int phi, const int psi) {
+    return ((phi + 180) / 10) * Bins + (psi + 180) / 10;
+}
+
+// Read a rotamer library text file into a table
+void PROT::RotamerLibrary::read (const string& name, Table& table) {
+    ifstream rotlib(file(name));
+    // if the file is not open, throw an error
+    if (!rotlib.is_open()) {
+        string error = "Could not open rotamer library file for residue " + name + "\n";
+        throw PANTZ_error (error);
+    }
+    vector<vector<Rotamer> > bins (Bins * Bins);
+    for (string line; getline(rotlib, line);) {
+        // skip comments and lines too short to hold a rotamer
+        if ((line.size() < 77) || (line[0] == '#')) {
+            continue;
+        }
+        // the phi and psi angles of the rotamer
+        int phi = stoi(line.substr(5, 5));
+        int psi = stoi(line.substr(10, 5));
+        if ((phi < -180) || (phi > 180) || (psi < -180) || (psi > 180)) {
+            continue;
+        }
+        Rotamer rotamer;
+        // the rotamer bins and probability follow the count
+        stringstream columns (line.substr(15, 32));
+        long count, r[4];
+        columns >> count >> r[0] >> r[1] >> r[2] >> r[3] >> rotamer.probability;
+        if (columns.fail()) {
+            string error = "Could not read this rotamer library line for residue " + name + ":\n" + line + "\n";
+            throw PANTZ_error (error);
+        }
+        // the mean and standard deviation of each chi angle. The standard
+        // deviations are not required, since only the means are used to build
+        // rotamers
+        for (size_t i = 0; i < 4; i++) {
+            rotamer.r[i] = r[i];
+            rotamer.chi[i] = stof(line.substr(47 + 8*i, 6));
+            rotamer.sigma[i] = 0;
+            if (line.size() >= 87 + 8*i) {
+                rotamer.sigma[i] = stof(line.substr(79 + 8*i, 8));
+            }
+        }
+        bins[bin(phi, psi)].push_back(rotamer);
+    }
+    // store the bins one after another
+    vector<Rotamer> records;
+    vector<uint32_t> offsets (1, 0);
+    for (size_t i = 0; i < bins.size(); i++) {
+        records.insert(records.end(), bins[i].begin(), bins[i].end());
+        offsets.push_back(records.size());
+    }
+    table.owned_records.swap(records);
+    table.owned_offsets.swap(offsets);
+    table.records = table.owned_records.data();
+    table.offsets = table.owned_offsets.data();
+}
+
+// Load a table, preferring the binary file unless the residue's text file has
+// changed since the binary file was compiled
+void PROT::RotamerLibrary::load (const string& name, Table& table) {
+    const Mapping& binary = mapping();
+    if (binary.data != nullptr) {
+        // look for the residue type in the binary file
+        for (size_t i = 0; i < binary.header->types; i++) {
+            if (strncmp(binary.names + 4*i, name.c_str(), 4) == 0) {
+                if (!current(name, binary.sources + 2*i)) {
+                    break;
+                }
+                table.records = binary.records;
+                table.offsets = binary.offsets + i * (binary.header->bins + 1);
+                return;
+            }
+        }
+    }
+    read(name, table);
+}
@@ -0,0 +1,45 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file is intended to be included by the RotamerLibrary.h header file. It
+ * implements the functions that look up rotamers in the libraries. */
+
+// Confirm that the RotamerLibrary class is loading the content
+#ifndef RotamerLibrary_Loading_Status
+#error RotamerLibrary methods must be included by RotamerLibrary.h
+#endif
+
+// The chi angles of a rotamer, leaving out the ones that are 0
+vector<float> PROT::RotamerLibrary::Rotamer::chi_angles () const {
+    vector<float> chis;
+    for (size_t i = 0; i < 4; i++) {
+        if (chi[i] != 0) {
+            chis.push_back(chi[i]);
+        }
+    }
+    return chis;
+}
+
+// Get the table of a residue type. The tables are never removed, so a
+// reference to one stays valid for the rest of the program
+PROT::RotamerLibrary::Table& PROT::RotamerLibrary::table (const string& name) {
+    static map<string, Table> tables;
+    static mutex lock;
+    lock_guard<mutex> guard (lock);
+    return tables[name];
+}
+
+// The rotamers of a residue type in a (phi, psi) bin
+PROT::RotamerLibrary::Bin PROT::RotamerLibrary::rotamers (const string& name, const int phi, const int psi) {
+    Table& library = table(name);
+    // Load the library the first time this residue type is used. If that
+    // fails, the error is passed on and the next call tries again
+    call_once(library.loaded, load, name, ref(library));
+    Bin result = {nullptr, 0};
+    if ((phi < -180) || (phi > 180) || (psi < -180) || (psi > 180)) {
+        return result;
+    }
+    size_t i = bin(phi, psi);
+    result.first = library.records + library.offsets[i];
+    result.count = library.offsets[i+1] - library.offsets[i];
+    return result;
+}
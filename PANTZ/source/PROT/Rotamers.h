@@ -0,0 +1,58 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file contains the declaration and implementation of the Rotamers class.
+ * It stores the coordinates of every rotamer of a Residue in one contiguous
+ * block. The rotamers have the same atoms, in the same order, as the Residue
+ * that owns them, so the names and other information about the atoms are not
+ * copied for each rotamer. */
+
+// Use a header guard to make sure this file is only included in a compiled
+// program a single time
+#ifndef Proteins_Rotamers_Guard
+#define Proteins_Rotamers_Guard 1
+
+// Make sure this file is being included from the Proteins.h header file
+#ifndef Proteins_Loading_Status
+#error Rotamers.h must be included by Proteins.h
+#endif
+
+// Define the Rotamers class
+class PROT::Rotamers {
+
+    // The information stored in the class is private
+    private:
+        // The number of atoms in each rotamer
+        size_t m_atoms;
+        // The coordinates of the atoms of every rotamer, one rotamer after
+        // another
+        vector<coor> m_coors;
+
+    // The public interface of the class
+    public:
+        // The default constructor
+        Rotamers () {m_atoms = 0;}
+        // Remove every rotamer and set how many atoms the new ones will have
+        void clear (const size_t atoms) {m_atoms = atoms; m_coors.clear();}
+        // Make room for a number of rotamers
+        void reserve (const size_t count) {m_coors.reserve(count * m_atoms * AtomCoordinates);}
+        // The number of rotamers and the number of atoms in each of them
+        size_t size () const {
+            if (m_atoms == 0) {return 0;}
+            return m_coors.size() / (m_atoms * AtomCoordinates);}
+        size_t atoms () const {return m_atoms;}
+        // Add a rotamer that starts with the provided coordinates, and return
+        // the place where its coordinates are stored. That place is only valid
+        // until the next rotamer is added
+        coor * add (const coor * coordinates) {
+            m_coors.insert(m_coors.end(), coordinates, coordinates + m_atoms * AtomCoordinates);
+            return &m_coors[m_coors.size() - m_atoms * AtomCoordinates];}
+        // The coordinates of a rotamer's atoms. The coordinates of atom j are
+        // values 3j to 3j+2
+        coor * operator[] (const size_t i) {return &m_coors[i * m_atoms * AtomCoordinates];}
+        const coor * operator[] (const size_t i) const {return &m_coors[i * m_atoms * AtomCoordinates];}
+
+    // End the class definition
+};
+
+// End the header guard from the start of the file
+#endif
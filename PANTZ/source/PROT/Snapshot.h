@@ -0,0 +1,167 @@
+/* Created by the Pantazes Lab at Auburn University.
+ *
+ * This file contains the declaration and implementation of the Snapshot class.
+ * A Snapshot is a set of Proteins whose Residues are reference counted, so
+ * copying a Snapshot shares every Residue with the original instead of copying
+ * its Atoms. A Residue is only copied when one of the Snapshots that share it
+ * changes it, so a mutant made from a wild type Snapshot stores only the
+ * Residues that were mutated. Snapshots are turned back into Proteins when a
+ * calculation needs to change or number the Residues as a whole. */
+
+// Use a header guard to make sure this file is only included in a compiled
+// program a single time
+#ifndef Proteins_Snapshot_Guard
+#define Proteins_Snapshot_Guard 1
+
+// Make sure this file is being included from the Proteins.h header file
+#ifndef Proteins_Loading_Status
+#error Snapshot.h must be included by Proteins.h
+#endif
+
+// Confirm that the Protein header has been included
+#ifndef Proteins_Protein_Guard
+#error Snapshot.h must be included after Protein.h
+#endif
+
+// The Residues are shared through reference counted pointers
+#include <memory>
+
+// Define the Snapshot class
+class PROT::Snapshot {
+
+    // The information stored in the class is private
+    private:
+        // A Protein in the Snapshot: its name and its Residues
+        struct Chain {
+            char name;
+            vector<shared_ptr<Residue> > residues;
+        };
+        // The Proteins, in the order they were provided
+        vector<Chain> m_chains;
+        // Throw an error if a Protein or a Residue is not in the Snapshot
+        void check (const size_t) const;
+        void check (const size_t, const size_t) const;
+
+    // The public interface of the class
+    public:
+        // An empty Snapshot
+        Snapshot () {}
+        // A Snapshot of a set of Proteins. The Residues are copied once, and
+        // the Proteins are not changed
+        explicit Snapshot (const vector<Protein>&);
+        // A Snapshot that takes the Residues of Proteins that are not needed
+        // any more instead of copying them
+        explicit Snapshot (vector<Protein>&&);
+        // Copying a Snapshot shares all of its Residues, which is what the
+        // default copy construction and assignment do
+        // The number of Proteins and the number of Residues in one of them
+        size_t proteins () const {return m_chains.size();}
+        size_t size (const size_t p) const {check(p); return m_chains[p].residues.size();}
+        // A Protein's name
+        char name (const size_t p) const {check(p); return m_chains[p].name;}
+        // Read access to a Residue
+        const Residue& residue (const size_t p, const size_t r) const {
+            check(p, r); return *m_chains[p].residues[r];}
+        // Write access to a Residue. If it is shared with another Snapshot,
+        // this Snapshot gets its own copy of it first
+        Residue * modify (const size_t, const size_t);
+        // Replace a Residue with a copy of another one
+        void replace (const size_t, const size_t, const Residue&);
+        // The number of Residues that are shared with another Snapshot
+        size_t shared (const Snapshot&) const;
+        // Make Proteins from the Snapshot. They have their own copies of the
+        // Residues, so they can be changed without changing the Snapshot
+        vector<Protein> materialize () const;
+
+    // End the class definition
+};
+
+// Throw an error if a Protein is not in the Snapshot
+void PROT::Snapshot::check (const size_t p) const {
+    if (p >= m_chains.size()) {
+        stringstream c1; c1 << p;
+        stringstream c2; c2 << m_chains.size();
+        string error = "Protein " + c1.str() + " is not in a Snapshot of "
+                       + c2.str() + " Proteins.\n";
+        throw PANTZ_error (error);}
+}
+
+// Throw an error if a Residue is not in the Snapshot
+void PROT::Snapshot::check (const size_t p, const size_t r) const {
+    check(p);
+    if (r >= m_chains[p].residues.size()) {
+        stringstream c1; c1 << r;
+        stringstream c2; c2 << m_chains[p].residues.size();
+        string error = "Residue " + c1.str() + " is not in a Protein of "
+                       + c2.str() + " Residues in a Snapshot.\n";
+        throw PANTZ_error (error);}
+}
+
+// Make a Snapshot by copying the Residues of a set of Proteins
+PROT::Snapshot::Snapshot (const vector<Protein>& proteins) {
+    m_chains.resize(proteins.size());
+    for(size_t i=0; i<proteins.size(); ++i) {
+        m_chains[i].name = proteins[i].m_name;
+        m_chains[i].residues.reserve(proteins[i].m_count);
+        for(size_t j=0; j<proteins[i].m_count; ++j) {
+            m_chains[i].residues.push_back(
+                make_shared<Residue>(proteins[i].m_residues[j]));}}
+}
+
+// Make a Snapshot by taking the Residues of a set of Proteins. The Proteins
+// are left empty
+PROT::Snapshot::Snapshot (vector<Protein>&& proteins) {
+    m_chains.resize(proteins.size());
+    for(size_t i=0; i<proteins.size(); ++i) {
+        m_chains[i].name = proteins[i].m_name;
+        m_chains[i].residues.reserve(proteins[i].m_count);
+        for(size_t j=0; j<proteins[i].m_count; ++j) {
+            m_chains[i].residues.push_back(
+                make_shared<Residue>(std::move(proteins[i].m_residues[j])));}
+        proteins[i].clean_up();
+        proteins[i].m_count = 0;}
+}
+
+// Get write access to a Residue, copying it first if it is shared
+PROT::Residue * PROT::Snapshot::modify (const size_t p, const size_t r) {
+    check(p, r);
+    shared_ptr<Residue>& residue = m_chains[p].residues[r];
+    if (residue.use_count() > 1) {residue = make_shared<Residue>(*residue);}
+    return residue.get();
+}
+
+// Replace a Residue. The Snapshots that shared the old one keep it
+void PROT::Snapshot::replace (const size_t p, const size_t r,
+                              const Residue& residue) {
+    check(p, r);
+    m_chains[p].residues[r] = make_shared<Residue>(residue);
+}
+
+// Count the Residues that this Snapshot and another one share
+size_t PROT::Snapshot::shared (const Snapshot& other) const {
+    size_t count = 0;
+    for(size_t i=0; (i<m_chains.size()) && (i<other.m_chains.size()); ++i) {
+        const vector<shared_ptr<Residue> >& mine = m_chains[i].residues;
+        const vector<shared_ptr<Residue> >& theirs = other.m_chains[i].residues;
+        for(size_t j=0; (j<mine.size()) && (j<theirs.size()); ++j) {
+            if (mine[j] == theirs[j]) {++count;}}}
+    return count;
+}
+
+// Make Proteins from the Snapshot the same way that Proteins are copied
+vector<PROT::Protein> PROT::Snapshot::materialize () const {
+    vector<Protein> proteins (m_chains.size());
+    for(size_t i=0; i<m_chains.size(); ++i) {
+        Protein& protein = proteins[i];
+        protein.m_name = m_chains[i].name;
+        protein.m_count = m_chains[i].residues.size();
+        if (protein.m_count > 0) {
+            protein.m_residues = new Residue [protein.m_count];
+            for(size_t j=0; j<protein.m_count; ++j) {
+                protein.m_residues[j] = *m_chains[i].residues[j];}}
+        protein.pack();}
+    return proteins;
+}
+
+// End the header guard from the start of the file
+#endif
@@ -37,6 +37,8 @@ class PROT::Structure {
     private:
         void copy (const Structure *);
         void copy (const Structure *, vector<Protein>&);
+        // Take the contents of a Structure that is about to be destroyed
+        void take (Structure&);
 
     // The public interface of the class
     public:
@@ -45,8 +47,13 @@ class PROT::Structure {
         // Copy construction and assignment
         Structure (const Structure& other) {copy(&other);}
         Structure (const Structure * other) {copy(other);}
-        void operator= (const Structure& other) {copy(&other);}
-        void operator= (const Structure * other) {copy(other);}
+        Structure& operator= (const Structure& other) {copy(&other); return *this;}
+        Structure& operator= (const Structure * other) {copy(other); return *this;}
+        // Move construction and assignment
+        Structure (Structure&& other) noexcept {take(other);}
+        Structure& operator= (Structure&& other) noexcept {
+            if (this != &other) {take(other);}
+            return *this;}
         // Copy construction for use in PDB file copying
         Structure (const Structure& other, vector<Protein>& prots) {
             copy(&other, prots);}
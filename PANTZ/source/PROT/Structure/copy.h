@@ -2,7 +2,7 @@
  *
  * This file is intended to be included in a compiled program by the Structure.h
  * header file, and includes pre-processor directives for that behavior. The
- * copy methods of the Structure class are defined here. */
+ * copy and take methods of the Structure class are defined here. */
 
 // Make sure the Structure class is currently being loaded
 #ifndef Structure_Loading_Status
@@ -52,3 +52,11 @@ void PROT::Structure::copy (const Structure * other, vector<Protein>& prots) {
                 error += " by the Structure copy function.\n";
                 throw PANTZ_error (error);}}}
 }
+
+// Take the contents of a Structure that is about to be destroyed
+void PROT::Structure::take (Structure& other) {
+    m_proteins = std::move(other.m_proteins);
+    m_names = std::move(other.m_names);
+    other.m_proteins.clear();
+    other.m_names.clear();
+}
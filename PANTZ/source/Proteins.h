@@ -18,6 +18,7 @@
 #include "Macros.h"
 // Include standard C++ files
 #include <cmath>
+#include <cstring>
 #include <fstream>
 #include <iomanip>
 #include <sstream>
@@ -42,6 +43,20 @@ namespace PROT {
     // The corresponding 1 letter codes
     const string AACodes = "A C D E F G H I K L M N P Q R S T V W Y";
     const vector<string> AA1 = Text::split(AACodes);
+    // The amino acids, in the same order as their names
+    enum AminoAcid {ALA, CYS, ASP, GLU, PHE, GLY, HIS, ILE, LYS, LEU,
+                    MET, ASN, PRO, GLN, ARG, SER, THR, VAL, TRP, TYR,
+                    HSD, HSE, NotAminoAcid};
+    const size_t StandardAminoAcids = 20;
+    const size_t AminoAcidNames = 22;
+    const char AminoAcidCodes [] = "ACDEFGHIKLMNPQRSTVWYHH";
+    // Find the amino acid with a 3 letter name or a 1 letter code. These are
+    // implemented in the Chemistry.h header file
+    AminoAcid amino_acid (const string&);
+    AminoAcid amino_acid (const char);
+    // The standard amino acid of an amino acid, which is HIS for HSD and HSE
+    inline AminoAcid standard (const AminoAcid aa) {
+        return ((aa == HSD) || (aa == HSE)) ? HIS : aa;}
     // The atoms that appear in the backbones of PDB-formatted amino acid
     // residues
     const string bbAtoms = "N H HN CA HA C O HN1 HN2 HT1 HT2 HT3 OT1 OT2";
@@ -52,6 +67,17 @@ namespace PROT {
     const size_t AtomStringLength = 81;
     // The dielectric constant of water
     const float CCELEC = 331.843;
+    // The squared distances below which items are certainly within a radius,
+    // and at or above which they certainly are not. The KDtree and Grid
+    // searches compare squared distances with these and only use the items'
+    // distance() method for the few items in between, whose distance is too
+    // close to the radius to be sure how distance() rounds. The result is
+    // always the same as comparing every item's distance() with the radius
+    inline void radius_limits (const float radius, double& inner, double& outer) {
+        inner = radius * (1.0 - 1e-4) - 1e-6;
+        outer = radius * (1.0 + 1e-4) + 1e-6;
+        inner = (inner > 0) ? inner * inner : -1;
+        outer = outer * outer;}
 
     // The matrix class is used to provide a standard container for linear
     // algebra-related tasks in this code. These are related to rotating and
@@ -69,6 +95,25 @@ namespace PROT {
     template<typename T>
     class KDtree;
 
+    // the Grid class also finds the items within a distance of another. It sorts
+    // the items into cubic cells, which is faster than the KDtree for short
+    // distances and can search for several distances at once
+    template<typename T>
+    class Grid;
+    // the NeighborList class keeps the neighbors found with a Grid so that
+    // they can be used again after the items have moved a little
+    template<typename T>
+    class NeighborList;
+    // the Arena class hands out memory for many small objects from a few
+    // large blocks and releases all of them at once
+    class Arena;
+    // the MappedFile class maps a file into memory so that it can be read in
+    // place
+    class MappedFile;
+
+    // The Names class interns the names that Atoms store as small IDs
+    class Names;
+
     // The Atom class is a container of information about a single Atom in a PDB
     // file
     class Atom;
@@ -85,6 +130,7 @@ namespace PROT {
                              const Atom *, const Atom *);
     coor calculate_dihedral (const Atom&, const Atom&, const Atom&, const Atom&);
     coor calculate_dihedral (AtomPtr&, AtomPtr&, AtomPtr&, AtomPtr&);
+    coor calculate_dihedral (const coor *, const coor *, const coor *, const coor *);
 
     // The Residue class is a container of Atoms that all are part of the same
     // amino acid. The ResiduePtr class is a wrapper that holds a pointer to a
@@ -92,6 +138,15 @@ namespace PROT {
     class Residue;
     class ResiduePtr;
 
+    // The coordinates of the rotamers of a Residue, stored in one block
+    class Rotamers;
+
+    // The heavy atoms of a Residue packed into arrays for fast clash checks
+    class PackedAtoms;
+
+    // The backbone dependent rotamer libraries, loaded once per program
+    class RotamerLibrary;
+
     // A struct to store information about hydrogen bonds
     struct HydrogenBond;
 
@@ -107,6 +162,9 @@ namespace PROT {
     // PDB files can contain multiple copies of the same Protein. The Structure
     // class contains all of the copies of that same protein.
     class Structure;
+    // A Snapshot is a set of Proteins whose Residues are shared with other
+    // Snapshots until one of them changes a Residue
+    class Snapshot;
 
     // The PDB class contains all of the information from a PDB-formatted file
     class PDB;
@@ -130,6 +188,20 @@ namespace CHECK {
     void temperature (const float);
     void element (const string&);
     void charge (const string&);
+    // The same checks, but returning whether or not the information is
+    // acceptable instead of throwing an error
+    bool is_atom_number (const long);
+    bool is_atom_name (const string&);
+    bool is_alt_location (const char);
+    bool is_residue_name (const string&);
+    bool is_protein_name (const char);
+    bool is_residue_number (const long);
+    bool is_insertion_code (const char);
+    bool is_atom_coordinate (const PROT::coor);
+    bool is_occupancy (const float);
+    bool is_temperature (const float);
+    bool is_element (const string&);
+    bool is_charge (const string&);
     // Check to see whether or not a string is an amino acid name
     bool is_amino_acid (const string&);
     // Check to see whether or not a string is a backbone atom
@@ -142,16 +214,26 @@ namespace CHECK {
 #define Proteins_Loading_Status 1
 
 // Include the header files that implement all of these classes
+#include "PROT/Chemistry.h"
 #include "PROT/Check.h"
 #include "PROT/Matrix.h"
 #include "PROT/KDtree.h"
+#include "PROT/Grid.h"
+#include "PROT/NeighborList.h"
+#include "PROT/Arena.h"
+#include "PROT/MappedFile.h"
+#include "PROT/RotamerLibrary.h"
+#include "PROT/Names.h"
 #include "PROT/Atom.h"
+#include "PROT/Rotamers.h"
 #include "PROT/Residue.h"
+#include "PROT/PackedAtoms.h"
 #include "PROT/HydrogenBond.h"
 #include "PROT/SaltBridge.h"
 #include "PROT/Hydrophobic.h"
 #include "PROT/Protein.h"
 #include "PROT/Structure.h"
+#include "PROT/Snapshot.h"
 #include "PROT/PDB.h"
 
 // Undefine the proteins loading status pre-processor variable
@@ -78,6 +78,7 @@ float PROTOCOL::EPPI_ddg(PROT::PDB* pdb, string mutation, string interface_, str
 
     // gather the proteins
     vector<PROT::Protein> proteins;
+    proteins.reserve(pdb->proteins());
     for (size_t i = 0; i < pdb->proteins(); i++) {
         proteins.push_back(*pdb->protein(i));
     }
@@ -189,42 +190,64 @@ float PROTOCOL::EPPI_ddg_ensemble(PROT::PDB* pdb, string mutation, string interf
 
     // calculate the average features for the ensemble
     vector<string> dir = METHODS::listdir(ensemble_path+"/");
-    // keep only the pdb files
+    // keep only the pdb and mmCIF files
     vector<string> ensemble_files;
     for (size_t i = 0; i < dir.size(); i++) {
-        if (dir[i].find(".pdb") != string::npos) {
+        if ((dir[i].find(".pdb") != string::npos) ||
+            (dir[i].find(".cif") != string::npos)) {
             ensemble_files.push_back(dir[i]);
         }
     }
     vector<vector<double>> avg_features;
-    // calculate the features for each pdb file
+    // the members of the ensemble have the same atoms and are close to each
+    // other, so the residue neighbor lists of one member can often be used for
+    // the next
+    EPPI::NeighborLists neighbor_lists;
+    // calculate the features for each pdb file. A file with several models
+    // holds several members of the ensemble. A member with different atoms
+    // than the first model gets proteins made from its own atoms
     for (size_t i = 0; i < ensemble_files.size(); i++) {
-        vector<PROT::Protein> proteins;
         // load the pdb file
         PROT::PDB pdb(ensemble_path+"/"+ensemble_files[i]);
-        for (size_t j = 0; j < pdb.proteins(); j++) {
-            proteins.push_back(*pdb.protein(j));
-        }
         // remove .pdb
         ensemble_files[i] = ensemble_files[i].substr(0, ensemble_files[i].size()-4);
-        if (minimize_inputs) {
-            ofstream min_log(ensemble_path+"/"+ensemble_files[i]+"/min_log.txt");
-            cout<<"Minimizing input structures"<<endl;
-            // minimize the input structures
-            Rosetta::Energy_Minimization(proteins, min_log, ensemble_path+"/"+ensemble_files[i]);
-        }
-        // gather the protein pointers
-        vector<PROT::Protein*> protein_ptrs;
-        for (size_t j = 0; j < proteins.size(); j++) {
-            protein_ptrs.push_back(&proteins[j]);
-        }
-        if (!already_calculated(ensemble_path+"/"+ensemble_files[i])) {
-            string output_path = ensemble_path+"/"+ensemble_files[i];
-            EPPI::calculate_eppi_features(protein_ptrs, interface_, output_path, true);
+        for (size_t model = 0; model < pdb.models(); model++) {
+            vector<PROT::Protein> proteins;
+            proteins.reserve(pdb.proteins());
+            string member = ensemble_files[i];
+            if (pdb.models() == 1) {
+                // the pdb file is not used again, so its proteins are moved
+                // out of it
+                for (size_t j = 0; j < pdb.proteins(); j++) {
+                    proteins.push_back(std::move(*pdb.protein(j)));
+                }
+            } else {
+                // the proteins are moved to this model's coordinates and copied
+                pdb.load_model(model);
+                for (size_t j = 0; j < pdb.proteins(); j++) {
+                    proteins.push_back(*pdb.protein(j));
+                }
+                member += "_" + to_string(model + 1);
+            }
+            if (minimize_inputs) {
+                ofstream min_log(ensemble_path+"/"+member+"/min_log.txt");
+                cout<<"Minimizing input structures"<<endl;
+                // minimize the input structures
+                Rosetta::Energy_Minimization(proteins, min_log, ensemble_path+"/"+member);
+            }
+            // gather the protein pointers
+            vector<PROT::Protein*> protein_ptrs;
+            for (size_t j = 0; j < proteins.size(); j++) {
+                protein_ptrs.push_back(&proteins[j]);
+            }
+            if (!already_calculated(ensemble_path+"/"+member)) {
+                string output_path = ensemble_path+"/"+member;
+                EPPI::calculate_eppi_features(protein_ptrs, interface_, output_path, true, &neighbor_lists);
+            }
+            // create BCProps for the mutated structures
+            EPPI::BCProps features(member, ensemble_path+"/"+member, true);
+            avg_features.push_back(features.base_features());
         }
-        // create BCProps for the mutated structures
-        EPPI::BCProps features(ensemble_files[i], ensemble_path+"/"+ensemble_files[i], true);
-        avg_features.push_back(features.base_features());
     }
 
     // average the base features of the ensemble
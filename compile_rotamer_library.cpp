@@ -0,0 +1,37 @@
+// this program compiles the backbone dependent rotamer library text files into the binary file that the
+// EPPI programs map into memory. It should be run again whenever the text files change
+#include "PANTZ/source/Methods.h"
+
+int main(int argc, char * argv[]) {
+    if (argc > 2) {
+        cout << "Usage: " << argv[0] << " [<output_file>]" << endl;
+        return 1;
+    }
+    // by default, the binary file is written where the programs look for it
+    string output = PROT::RotamerLibrary::binary_file();
+    if (argc == 2) {
+        output = argv[1];
+    }
+    try {
+        // find the residue types that have a library text file
+        const string suffix = ".bbdep.rotamers.lib";
+        vector<string> files = METHODS::listdir(PROT::RotamerLibrary::directory());
+        vector<string> names;
+        for (size_t i = 0; i < files.size(); i++) {
+            if ((files[i].size() > suffix.size()) &&
+                (files[i].compare(files[i].size() - suffix.size(), suffix.size(), suffix) == 0)) {
+                names.push_back(files[i].substr(0, files[i].size() - suffix.size()));
+            }
+        }
+        if (names.empty()) {
+            throw PANTZ_error("No rotamer library files were found in " + PROT::RotamerLibrary::directory() + "\n");
+        }
+        PROT::RotamerLibrary::compile(names, output);
+        cout << "Compiled " << names.size() << " rotamer libraries into " << output << endl;
+    }
+    catch (PANTZ_error& e) {
+        cout << e.what();
+        return 1;
+    }
+    return 0;
+}